@@ -1,81 +1,111 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "crcKernel.h"
+#include "crcStats.h"
+
 //This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
 // https://www.autosar.org/fileadmin/files/standards/classic/
 
 // Good page for checking your CRC:
 // http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
 
-
-extern uint32_t reflect(uint32_t data, uint8_t nBits);
+//Thin wrappers around the CRC kernels in crcKernel.h.
 
 void Crc16TableGenerator(uint16_t polynomial, uint16_t crcTable[256])
 {
-    uint16_t remainder;
+    CrcTableGenerator<uint16_t>(polynomial, crcTable);
+}
 
-    uint16_t topBit = 0x8000;
-    uint32_t ui32Dividend;
+// Lookup table for reflected (LSB first) algorithm, polynomial is given in the normal MSB first form.
+void Crc16ReflectedTableGenerator(uint16_t polynomial, uint16_t crcTable[256])
+{
+    CrcReflectedTableGenerator<uint16_t>(polynomial, crcTable);
+}
 
-    for (ui32Dividend = 0; ui32Dividend < 256; ui32Dividend++)
-    {
-        remainder = ui32Dividend << 8;
-
-        for (uint8_t bit = 0; bit < 8; bit++)
-        {
-            if (0 == (remainder & topBit))
-            {
-                remainder <<= 1;
-            }
-            else
-            {
-                remainder = (remainder << 1) ^ polynomial;
-            }
-        }
-
-        crcTable[ui32Dividend] = remainder;
-
-        //remove comments if you want print CRC 256 lookup table 
-        /*
-        if (0 == dividend % 8)
-        {
-            printf("\n");
-        }
-        printf("0x%04xU, ", remainder);
-
-        */
+// Extended lookup tables for slicing-by-8/16. crcTable[0] is the same table as Crc16TableGenerator(),
+// crcTable[k][d] is the CRC of byte d followed by k zero bytes.
+void Crc16SlicingTableGenerator(uint16_t polynomial, uint16_t crcTable[][256], uint8_t nSlices)
+{
+    CrcSlicingTableGenerator<uint16_t>(polynomial, crcTable, nSlices);
+}
 
-    }
+// Reflected slicing tables for CalculateCRC16ReflectedSlicing8/16(), crcTable[0] is the same table as
+// Crc16ReflectedTableGenerator().
+void Crc16ReflectedSlicingTableGenerator(uint16_t polynomial, uint16_t crcTable[][256], uint8_t nSlices)
+{
+    CrcReflectedSlicingTableGenerator<uint16_t>(polynomial, crcTable, nSlices);
+}
+
+// 16 entry table for CalculateCRC16Nibble(), 32 bytes instead of 512 bytes
+void Crc16NibbleTableGenerator(uint16_t polynomial, uint16_t crcTable[16])
+{
+    CrcNibbleTableGenerator<uint16_t>(polynomial, crcTable);
 }
 
 uint16_t CalculateCRC16(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
 {
-    uint32_t ui32Counter;
-    uint8_t temp;
-    uint16_t crc = crc_InitialValue;
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_TABLE, crc_Length);
 
-    for (ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
-    {
-        if (reflectedInput)
-        {
-            temp = reflect(*crc_DataPtr, 8);
-        }
-        else
-        {
-            temp = *crc_DataPtr;
-        }
-
-        crc = (crc << 8) ^ crcTable[(uint8_t)((crc >> 8) ^ temp)];
-        crc_DataPtr++;
+    return CalculateCRC<uint16_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
 
-    }
+// Reflected input CRC16 (e.g. ARC, MODBUS, KERMIT) with table from Crc16ReflectedTableGenerator(), no per byte reflect() call.
+// crc_InitialValue, crc_XorValue and reflectedOutput have the same meaning as for CalculateCRC16() with reflectedInput = true.
+uint16_t CalculateCRC16Reflected(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_REFLECTED, crc_Length);
 
-    crc ^= crc_XorValue;
-    if (reflectedOutput)
-    {
-        crc = reflect(crc, 16);
-    }
-    return crc;
+    return CalculateCRCReflected<uint16_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// crcTable has to be generated by Crc16SlicingTableGenerator() with at least 8 slices
+uint16_t CalculateCRC16Slicing8(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_SLICING8, crc_Length);
+
+    return CalculateCRCSlicing<uint16_t, 8>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable has to be generated by Crc16SlicingTableGenerator() with 16 slices
+uint16_t CalculateCRC16Slicing16(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_SLICING16, crc_Length);
+
+    return CalculateCRCSlicing<uint16_t, 16>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Slicing-by-8 for reflected input models with table from Crc16ReflectedSlicingTableGenerator() with at least 8 slices,
+// parameters have the same meaning as for CalculateCRC16Reflected()
+uint16_t CalculateCRC16ReflectedSlicing8(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_SLICING8, crc_Length);
+
+    return CalculateCRCReflectedSlicing<uint16_t, 8>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Slicing-by-16 for reflected input models with table from Crc16ReflectedSlicingTableGenerator() with 16 slices
+uint16_t CalculateCRC16ReflectedSlicing16(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_SLICING16, crc_Length);
+
+    return CalculateCRCReflectedSlicing<uint16_t, 16>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Two lookups per byte in the table from Crc16NibbleTableGenerator(), parameters have the same meaning as for CalculateCRC16()
+uint16_t CalculateCRC16Nibble(uint16_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_NIBBLE, crc_Length);
+
+    return CalculateCRCNibble<uint16_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Without lookup table, parameters have the same meaning as for CalculateCRC16()
+uint16_t CalculateCRC16Bitwise(uint16_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_BITWISE, crc_Length);
+
+    return CalculateCRCBitwise<uint16_t>(polynomial, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
 }
 
 void TestCRC16(uint16_t calculatedCrc, uint16_t expectedCrc)
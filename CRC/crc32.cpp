@@ -1,81 +1,111 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "crcKernel.h"
+#include "crcStats.h"
+
 //This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
 // https://www.autosar.org/fileadmin/files/standards/classic/
 
 // Good page for checking your CRC:
 // http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
 
-
-extern uint32_t reflect(uint32_t data, uint8_t nBits);
+//Thin wrappers around the CRC kernels in crcKernel.h.
 
 void Crc32TableGenerator(uint32_t polynomial, uint32_t crcTable[256])
 {
-    uint32_t remainder;
+    CrcTableGenerator<uint32_t>(polynomial, crcTable);
+}
 
-    uint32_t topBit = 0x80000000;
-    uint32_t ui32Dividend;
+// Lookup table for reflected (LSB first) algorithm, polynomial is given in the normal MSB first form.
+void Crc32ReflectedTableGenerator(uint32_t polynomial, uint32_t crcTable[256])
+{
+    CrcReflectedTableGenerator<uint32_t>(polynomial, crcTable);
+}
 
-    for (ui32Dividend = 0; ui32Dividend < 256; ui32Dividend++)
-    {
-        remainder = ui32Dividend << 24;
-
-        for (uint8_t bit = 0; bit < 8; bit++)
-        {
-            if (0 == (remainder & topBit))
-            {
-                remainder <<= 1;
-            }
-            else
-            {
-                remainder = (remainder << 1) ^ polynomial;
-            }
-        }
-
-        crcTable[ui32Dividend] = remainder;
-
-        //remove comments if you want print CRC 256 lookup table 
-        /*
-        if (0 == dividend % 8)
-        {
-            printf("\n");
-        }
-        printf("0x%08xU, ", remainder);
-
-        */
+// Extended lookup tables for slicing-by-8/16. crcTable[0] is the same table as Crc32TableGenerator(),
+// crcTable[k][d] is the CRC of byte d followed by k zero bytes.
+void Crc32SlicingTableGenerator(uint32_t polynomial, uint32_t crcTable[][256], uint8_t nSlices)
+{
+    CrcSlicingTableGenerator<uint32_t>(polynomial, crcTable, nSlices);
+}
 
-    }
+// Reflected slicing tables for CalculateCRC32ReflectedSlicing8/16(), crcTable[0] is the same table as
+// Crc32ReflectedTableGenerator().
+void Crc32ReflectedSlicingTableGenerator(uint32_t polynomial, uint32_t crcTable[][256], uint8_t nSlices)
+{
+    CrcReflectedSlicingTableGenerator<uint32_t>(polynomial, crcTable, nSlices);
+}
+
+// 16 entry table for CalculateCRC32Nibble(), 64 bytes instead of 1 KB
+void Crc32NibbleTableGenerator(uint32_t polynomial, uint32_t crcTable[16])
+{
+    CrcNibbleTableGenerator<uint32_t>(polynomial, crcTable);
 }
 
 uint32_t CalculateCRC32(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
 {
-    uint32_t ui32Counter;
-    uint8_t temp;
-    uint32_t crc = crc_InitialValue;
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_TABLE, crc_Length);
 
-    for (ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
-    {
-        if (reflectedInput)
-        {
-            temp = reflect(*crc_DataPtr, 8);
-        }
-        else
-        {
-            temp = *crc_DataPtr;
-        }
-
-        crc = (crc << 8) ^ crcTable[(uint8_t)((crc >> 24) ^ temp)];
-        crc_DataPtr++;
+    return CalculateCRC<uint32_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
 
-    }
+// Reflected input CRC32 (e.g. Ethernet) with table from Crc32ReflectedTableGenerator(), no per byte reflect() call.
+// crc_InitialValue, crc_XorValue and reflectedOutput have the same meaning as for CalculateCRC32() with reflectedInput = true.
+uint32_t CalculateCRC32Reflected(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_REFLECTED, crc_Length);
 
-    crc ^= crc_XorValue;
-    if (reflectedOutput)
-    {
-        crc = reflect(crc, sizeof(uint32_t) * 8);
-    }
-    return crc;
+    return CalculateCRCReflected<uint32_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// crcTable has to be generated by Crc32SlicingTableGenerator() with at least 8 slices
+uint32_t CalculateCRC32Slicing8(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_SLICING8, crc_Length);
+
+    return CalculateCRCSlicing<uint32_t, 8>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable has to be generated by Crc32SlicingTableGenerator() with 16 slices
+uint32_t CalculateCRC32Slicing16(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_SLICING16, crc_Length);
+
+    return CalculateCRCSlicing<uint32_t, 16>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Slicing-by-8 for reflected input models with table from Crc32ReflectedSlicingTableGenerator() with at least 8 slices,
+// parameters have the same meaning as for CalculateCRC32Reflected()
+uint32_t CalculateCRC32ReflectedSlicing8(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_SLICING8, crc_Length);
+
+    return CalculateCRCReflectedSlicing<uint32_t, 8>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Slicing-by-16 for reflected input models with table from Crc32ReflectedSlicingTableGenerator() with 16 slices
+uint32_t CalculateCRC32ReflectedSlicing16(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_SLICING16, crc_Length);
+
+    return CalculateCRCReflectedSlicing<uint32_t, 16>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Two lookups per byte in the table from Crc32NibbleTableGenerator(), parameters have the same meaning as for CalculateCRC32()
+uint32_t CalculateCRC32Nibble(uint32_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_NIBBLE, crc_Length);
+
+    return CalculateCRCNibble<uint32_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Without lookup table, parameters have the same meaning as for CalculateCRC32()
+uint32_t CalculateCRC32Bitwise(uint32_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_BITWISE, crc_Length);
+
+    return CalculateCRCBitwise<uint32_t>(polynomial, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
 }
 
 void TestCRC32(uint32_t calculatedCrc, uint32_t expectedCrc)
@@ -88,4 +118,4 @@ void TestCRC32(uint32_t calculatedCrc, uint32_t expectedCrc)
     {
         printf("CRC32 0x%02x OK!\n", calculatedCrc);
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "crcKernel.h"
+#include "crcStats.h"
+
+//This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
+// https://www.autosar.org/fileadmin/files/standards/classic/
+
+// Good page for checking your CRC:
+// http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
+
+//Thin wrappers around the CRC kernels in crcKernel.h.
+
+void Crc64TableGenerator(uint64_t polynomial, uint64_t crcTable[256])
+{
+    CrcTableGenerator<uint64_t>(polynomial, crcTable);
+}
+
+// Lookup table for reflected (LSB first) algorithm, polynomial is given in the normal MSB first form.
+void Crc64ReflectedTableGenerator(uint64_t polynomial, uint64_t crcTable[256])
+{
+    CrcReflectedTableGenerator<uint64_t>(polynomial, crcTable);
+}
+
+// Extended lookup tables for slicing-by-8/16. crcTable[0] is the same table as Crc64TableGenerator(),
+// crcTable[k][d] is the CRC of byte d followed by k zero bytes.
+void Crc64SlicingTableGenerator(uint64_t polynomial, uint64_t crcTable[][256], uint8_t nSlices)
+{
+    CrcSlicingTableGenerator<uint64_t>(polynomial, crcTable, nSlices);
+}
+
+// Reflected slicing tables for CalculateCRC64ReflectedSlicing8/16(), crcTable[0] is the same table as
+// Crc64ReflectedTableGenerator().
+void Crc64ReflectedSlicingTableGenerator(uint64_t polynomial, uint64_t crcTable[][256], uint8_t nSlices)
+{
+    CrcReflectedSlicingTableGenerator<uint64_t>(polynomial, crcTable, nSlices);
+}
+
+// 16 entry table for CalculateCRC64Nibble(), 128 bytes instead of 2 KB
+void Crc64NibbleTableGenerator(uint64_t polynomial, uint64_t crcTable[16])
+{
+    CrcNibbleTableGenerator<uint64_t>(polynomial, crcTable);
+}
+
+uint64_t CalculateCRC64(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_TABLE, crc_Length);
+
+    return CalculateCRC<uint64_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Reflected input CRC64 (e.g. ECMA-182 in AUTOSAR) with table from Crc64ReflectedTableGenerator(), no per byte reflect() call.
+// crc_InitialValue, crc_XorValue and reflectedOutput have the same meaning as for CalculateCRC64() with reflectedInput = true.
+uint64_t CalculateCRC64Reflected(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_REFLECTED, crc_Length);
+
+    return CalculateCRCReflected<uint64_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// crcTable has to be generated by Crc64SlicingTableGenerator() with at least 8 slices
+uint64_t CalculateCRC64Slicing8(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_SLICING8, crc_Length);
+
+    return CalculateCRCSlicing<uint64_t, 8>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable has to be generated by Crc64SlicingTableGenerator() with 16 slices
+uint64_t CalculateCRC64Slicing16(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_SLICING16, crc_Length);
+
+    return CalculateCRCSlicing<uint64_t, 16>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Slicing-by-8 for reflected input models with table from Crc64ReflectedSlicingTableGenerator() with at least 8 slices,
+// parameters have the same meaning as for CalculateCRC64Reflected()
+uint64_t CalculateCRC64ReflectedSlicing8(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_SLICING8, crc_Length);
+
+    return CalculateCRCReflectedSlicing<uint64_t, 8>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Slicing-by-16 for reflected input models with table from Crc64ReflectedSlicingTableGenerator() with 16 slices
+uint64_t CalculateCRC64ReflectedSlicing16(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_SLICING16, crc_Length);
+
+    return CalculateCRCReflectedSlicing<uint64_t, 16>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Two lookups per byte in the table from Crc64NibbleTableGenerator(), parameters have the same meaning as for CalculateCRC64()
+uint64_t CalculateCRC64Nibble(uint64_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_NIBBLE, crc_Length);
+
+    return CalculateCRCNibble<uint64_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Without lookup table, parameters have the same meaning as for CalculateCRC64()
+uint64_t CalculateCRC64Bitwise(uint64_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_BITWISE, crc_Length);
+
+    return CalculateCRCBitwise<uint64_t>(polynomial, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+void TestCRC64(uint64_t calculatedCrc, uint64_t expectedCrc)
+{
+    if (expectedCrc != calculatedCrc)
+    {
+        printf("Error for CRC64 0x%llx\n", (unsigned long long)calculatedCrc);
+    }
+    else
+    {
+        printf("CRC64 0x%016llx OK!\n", (unsigned long long)calculatedCrc);
+    }
+}
@@ -1,80 +1,64 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "crcKernel.h"
+#include "crcStats.h"
+
 //This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
 // https://www.autosar.org/fileadmin/files/standards/classic/
 
 // Good page for checking your CRC:
 // http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
 
-
-extern uint32_t reflect(uint32_t data, uint8_t nBits);
+//Thin wrappers around the CRC kernels in crcKernel.h.
 
 void Crc8TableGenerator(uint8_t polynomial, uint8_t crcTable[256])
 {
-    uint8_t remainder;
-
-    uint8_t topBit = 0x80;
-    uint32_t ui32Dividend;
+    CrcTableGenerator<uint8_t>(polynomial, crcTable);
+}
 
-    for (ui32Dividend = 0; ui32Dividend < 256; ui32Dividend++)
-    {
-        remainder = ui32Dividend;
-
-        for (uint8_t bit = 0; bit < 8; bit++)
-        {
-            if (0 == (remainder & topBit))
-            {
-                remainder <<= 1;
-            }
-            else
-            {
-                remainder = (remainder << 1) ^ polynomial;
-            }
-        }
-
-        crcTable[ui32Dividend] = remainder;
-
-        //remove comments if you want print CRC 256 lookup table 
-        /*
-        if (0 == dividend % 8)
-        {
-            printf("\n");
-        }
-        printf("0x%02xU, ", remainder);
-        */
+// Lookup table for reflected (LSB first) algorithm, polynomial is given in the normal MSB first form.
+void Crc8ReflectedTableGenerator(uint8_t polynomial, uint8_t crcTable[256])
+{
+    CrcReflectedTableGenerator<uint8_t>(polynomial, crcTable);
+}
 
-    }
+// 16 entry table for CalculateCRC8Nibble(), 16 bytes instead of 256 bytes
+void Crc8NibbleTableGenerator(uint8_t polynomial, uint8_t crcTable[16])
+{
+    CrcNibbleTableGenerator<uint8_t>(polynomial, crcTable);
 }
 
 uint8_t CalculateCRC8(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
 {
-    uint32_t ui32Counter;
-    uint8_t temp;
-    uint8_t crc = crc_InitialValue;
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_TABLE, crc_Length);
 
-    for (ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
-    {
-        if (reflectedInput)
-        {
-            temp = reflect(*crc_DataPtr, 8);
-        }
-        else
-        {
-            temp = *crc_DataPtr;
-        }
-
-        crc = crc ^ temp;
-        crc = crcTable[crc];
-        crc_DataPtr++;
-    }
+    return CalculateCRC<uint8_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
 
-    crc ^= crc_XorValue;
-    if (reflectedOutput)
-    {
-        crc = reflect(crc, 8);
-    }
-    return crc;
+// Reflected input CRC8 (e.g. CRC-8/MAXIM-DOW) with table from Crc8ReflectedTableGenerator(), no per byte reflect() call.
+// crc_InitialValue, crc_XorValue and reflectedOutput have the same meaning as for CalculateCRC8() with reflectedInput = true.
+uint8_t CalculateCRC8Reflected(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_REFLECTED, crc_Length);
+
+    return CalculateCRCReflected<uint8_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput);
+}
+
+// Two lookups per byte in the table from Crc8NibbleTableGenerator(), parameters have the same meaning as for CalculateCRC8()
+uint8_t CalculateCRC8Nibble(uint8_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_NIBBLE, crc_Length);
+
+    return CalculateCRCNibble<uint8_t>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// Without lookup table, parameters have the same meaning as for CalculateCRC8()
+uint8_t CalculateCRC8Bitwise(uint8_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_BITWISE, crc_Length);
+
+    return CalculateCRCBitwise<uint8_t>(polynomial, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
 }
 
 void TestCRC8(uint8_t calculatedCrc, uint8_t expectedCrc)
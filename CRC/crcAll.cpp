@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdint.h>
 
+#include "crcKernel.h"
+
 //This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
 // https://www.autosar.org/fileadmin/files/standards/classic/
 
@@ -8,100 +10,7 @@
 // http://www.sunshine2k.de/coding/javascript/crc/crc_js.html
 
 
-extern uint32_t reflect(uint32_t data, uint8_t nBits);
-
-template <class T>
-void CrcTableGenerator(T polynomial, T (&crcTable)[256])
-{
-    T remainder;
-
-    T topBit = 0x01 << (8*sizeof(T) - 1);
-    uint32_t ui32Dividend;
-
-    for (ui32Dividend = 0; ui32Dividend  < 256; ui32Dividend++)
-    {
-        remainder = ui32Dividend << (8*sizeof(T) - 8);
-
-        for (uint8_t bit = 0; bit < 8; bit++)
-        {
-            if (0 == (remainder & topBit))
-            {
-                remainder <<= 1;
-            }
-            else
-            {
-                remainder = (remainder << 1) ^ polynomial;
-            }
-        }
-
-        crcTable[ui32Dividend] = remainder;
-
-        //remove comments if you want print CRC 256 lookup table 
-        /*
-        if (0 == dividend % 8)
-        {
-            printf("\n");
-        }
-        if (sizeof(T) == sizeof(uint8_t))
-        {
-            printf("0x%02xU, ", remainder);
-        }
-        else if (sizeof(T) == sizeof(uint16_t))
-        {
-            printf("0x%04xU, ", remainder);
-        }
-        else
-        {
-            printf("0x%08xU, ", remainder);
-        }
-        */
-
-    }
-}
-
-template <class T>
-T CalculateCRC(T(&crcTable)[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput)
-{
-    uint32_t ui32Counter;
-    uint8_t temp;
-    T crc = crc_InitialValue;
-
-    for (ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
-    {
-        if (reflectedInput)
-        {
-            temp = reflect(*crc_DataPtr, 8);
-        }
-        else
-        {
-            temp = *crc_DataPtr;
-        }
-
-        if (1 == sizeof(T)) // CRC8
-        {
-            crc = crc ^ temp;
-            crc = crcTable[crc];
-        }
-        else if (2 == sizeof(T)) // CRC16
-        {
-            crc = (crc << 8) ^ crcTable[(uint8_t)((crc >> 8) ^ temp)];
-        }
-        else // CRC32
-        {
-            crc = (crc << 8) ^ crcTable[(uint8_t)((crc >> 24) ^ temp)] ;
-        }
-
-        crc_DataPtr++;
-
-    }
-
-    crc ^= crc_XorValue;
-    if (reflectedOutput)
-    {
-        crc = reflect(crc, sizeof(T) * 8);
-    }
-    return crc;
-}
+//Generic table generators and CalculateCRC<T>() are in crcKernel.h.
 
 template <class T>
 void TestCRC(T calculatedCrc, T expectedCrc)
@@ -121,6 +30,11 @@ int main2()
     uint8_t crcTable8bit[256];
     uint16_t crcTable16bit[256];
     uint32_t crcTable32bit[256];
+    uint16_t crcSlicing8Table16bit[8][256];
+    uint16_t crcSlicing16Table16bit[16][256];
+    uint32_t crcSlicing8Table32bit[8][256];
+    uint32_t crcSlicing16Table32bit[16][256];
+    uint32_t crcReflectedTable32bit[256];
 
     uint8_t message1[] = { 0x00, 0x00, 0x00, 0x00 };
     uint8_t message2[] = { 0xF2, 0x01, 0x83 };
@@ -129,6 +43,12 @@ int main2()
     uint8_t message5[] = { 0x33, 0x22, 0x55, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0XFF };
     uint8_t message6[] = { 0x92, 0x6B, 0x55 };
     uint8_t message7[] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    uint8_t longMessage[1027];
+
+    for (uint32_t i = 0U; i < sizeof(longMessage); i++)
+    {
+        longMessage[i] = (uint8_t)(i * 31U + 7U);
+    }
 
     uint8_t polynominal8bit;
     uint8_t initValue;
@@ -176,6 +96,16 @@ int main2()
     TestCRC<uint16_t>(CalculateCRC<uint16_t>(crcTable16bit, message6, sizeof(message6), initValue16bit, xorValue16bit, false, false), 0x0745);
     TestCRC<uint16_t>(CalculateCRC<uint16_t>(crcTable16bit, message7, sizeof(message7), initValue16bit, xorValue16bit, false, false), 0x1D0F);
 
+    //CCITT-FALSE CRC16 slicing-by-8 and slicing-by-16 against the byte loop
+    CrcSlicingTableGenerator<uint16_t>(polynominal16bit, crcSlicing8Table16bit, 8);
+    CrcSlicingTableGenerator<uint16_t>(polynominal16bit, crcSlicing16Table16bit, 16);
+
+    TestCRC<uint16_t>(CalculateCRCSlicing<uint16_t, 8>(crcSlicing8Table16bit, message5, sizeof(message5), initValue16bit, xorValue16bit, false, false), 0xF53F);
+    TestCRC<uint16_t>(CalculateCRCSlicing<uint16_t, 8>(crcSlicing8Table16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false),
+                      CalculateCRC<uint16_t>(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false));
+    TestCRC<uint16_t>(CalculateCRCSlicing<uint16_t, 16>(crcSlicing16Table16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false),
+                      CalculateCRC<uint16_t>(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false));
+
     //Ethernet CRC Calculation - CRC32
     uint32_t polynominal32bit   = 0x04C11DB7;
     uint32_t initValue32bit     = 0xFFFFFFFF;
@@ -190,5 +120,28 @@ int main2()
     TestCRC<uint32_t>(CalculateCRC<uint32_t>(crcTable32bit, message6, sizeof(message6), initValue32bit, xorValue32bit, true, true), 0x9CDEA29B);
     TestCRC<uint32_t>(CalculateCRC<uint32_t>(crcTable32bit, message7, sizeof(message7), initValue32bit, xorValue32bit, true, true), 0xFFFFFFFF);
 
+    //Ethernet CRC32 with reflected table
+    CrcReflectedTableGenerator<uint32_t>(polynominal32bit, crcReflectedTable32bit);
+
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message1, sizeof(message1), initValue32bit, xorValue32bit, true), 0x2144DF1C);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message2, sizeof(message2), initValue32bit, xorValue32bit, true), 0x24AB9D77);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message3, sizeof(message3), initValue32bit, xorValue32bit, true), 0xB6C9B287);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message4, sizeof(message4), initValue32bit, xorValue32bit, true), 0x32A06212);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true), 0xB0AE863D);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message6, sizeof(message6), initValue32bit, xorValue32bit, true), 0x9CDEA29B);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, message7, sizeof(message7), initValue32bit, xorValue32bit, true), 0xFFFFFFFF);
+    TestCRC<uint32_t>(CalculateCRCReflected<uint32_t>(crcReflectedTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, false),
+                      CalculateCRC<uint32_t>(crcTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, false, true));
+
+    //Ethernet CRC32 slicing-by-8 and slicing-by-16 against the byte loop
+    CrcSlicingTableGenerator<uint32_t>(polynominal32bit, crcSlicing8Table32bit, 8);
+    CrcSlicingTableGenerator<uint32_t>(polynominal32bit, crcSlicing16Table32bit, 16);
+
+    TestCRC<uint32_t>(CalculateCRCSlicing<uint32_t, 8>(crcSlicing8Table32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true, true), 0xB0AE863D);
+    TestCRC<uint32_t>(CalculateCRCSlicing<uint32_t, 8>(crcSlicing8Table32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+                      CalculateCRC<uint32_t>(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC<uint32_t>(CalculateCRCSlicing<uint32_t, 16>(crcSlicing16Table32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+                      CalculateCRC<uint32_t>(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+
     return 0;
 }
@@ -0,0 +1,67 @@
+#include <stdint.h>
+
+#include "crcModel.h"
+#include "crcStats.h"
+
+//This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
+// https://www.autosar.org/fileadmin/files/standards/classic/
+
+//AUTOSAR Crc module interface. Data can be given in several calls: first call with crc_IsFirstCall = true,
+//every next call with crc_IsFirstCall = false and the result of the previous call as start value.
+//Result of the last call is the CRC of all data together, no copy into one buffer is needed.
+
+template <class Model>
+static typename Model::T Crc_Calculate(const uint8_t *crc_DataPtr, uint32_t crc_Length, typename Model::T crc_StartValue, bool crc_IsFirstCall)
+{
+    typename Model::T crc = crc_IsFirstCall ? Model::Start() : Model::Restart(crc_StartValue);
+
+    return Model::Finalize(Model::Update(crc, crc_DataPtr, crc_Length));
+}
+
+// CRC8 SAE-J1850, polynomial 0x1D
+uint8_t Crc_CalculateCRC8(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_StartValue8, bool crc_IsFirstCall)
+{
+    CRC_STATS_SCOPE(CRC_MODEL_CRC8, CRC_STATS_TABLE, crc_Length);
+
+    return Crc_Calculate<Crc8SaeJ1850>(crc_DataPtr, crc_Length, crc_StartValue8, crc_IsFirstCall);
+}
+
+// CRC8 polynomial 0x2F
+uint8_t Crc_CalculateCRC8H2F(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_StartValue8H2F, bool crc_IsFirstCall)
+{
+    CRC_STATS_SCOPE(CRC_MODEL_CRC8H2F, CRC_STATS_TABLE, crc_Length);
+
+    return Crc_Calculate<Crc8H2F>(crc_DataPtr, crc_Length, crc_StartValue8H2F, crc_IsFirstCall);
+}
+
+// CRC16 CCITT-FALSE, polynomial 0x1021
+uint16_t Crc_CalculateCRC16(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_StartValue16, bool crc_IsFirstCall)
+{
+    CRC_STATS_SCOPE(CRC_MODEL_CRC16, CRC_STATS_TABLE, crc_Length);
+
+    return Crc_Calculate<Crc16CcittFalse>(crc_DataPtr, crc_Length, crc_StartValue16, crc_IsFirstCall);
+}
+
+// CRC32 Ethernet (IEEE-802.3), polynomial 0x04C11DB7
+uint32_t Crc_CalculateCRC32(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_StartValue32, bool crc_IsFirstCall)
+{
+    CRC_STATS_SCOPE(CRC_MODEL_CRC32, CRC_STATS_TABLE, crc_Length);
+
+    return Crc_Calculate<Crc32Ethernet>(crc_DataPtr, crc_Length, crc_StartValue32, crc_IsFirstCall);
+}
+
+// CRC32 E2E Profile 4, polynomial 0xF4ACFB13
+uint32_t Crc_CalculateCRC32P4(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_StartValue32, bool crc_IsFirstCall)
+{
+    CRC_STATS_SCOPE(CRC_MODEL_CRC32P4, CRC_STATS_TABLE, crc_Length);
+
+    return Crc_Calculate<Crc32P4>(crc_DataPtr, crc_Length, crc_StartValue32, crc_IsFirstCall);
+}
+
+// CRC64 ECMA-182, polynomial 0x42F0E1EBA9EA3693
+uint64_t Crc_CalculateCRC64(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_StartValue64, bool crc_IsFirstCall)
+{
+    CRC_STATS_SCOPE(CRC_MODEL_CRC64, CRC_STATS_TABLE, crc_Length);
+
+    return Crc_Calculate<Crc64Ecma>(crc_DataPtr, crc_Length, crc_StartValue64, crc_IsFirstCall);
+}
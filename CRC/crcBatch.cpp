@@ -0,0 +1,149 @@
+#include <stdint.h>
+
+#include "crcKernel.h"
+#include "crcCombine.h"
+#include "crcStats.h"
+
+//CRC of many short messages in one call. A single short CRC is limited by the latency of its table lookup chain,
+//here several messages are calculated at the same time in interleaved scalar lanes so their lookups overlap.
+//Message i is crc_DataPtrs[i] with crc_Lengths[i] bytes, its CRC is written to crcResults[i].
+//
+//Four lanes keep pointers, counts and registers of all lanes in registers, more lanes spill them. An AVX2 variant
+//with gather lookups was measured as well: it only keeps up with the scalar lanes when all 8 messages of a vector
+//have the same length of 32 bytes or more, with mixed lengths it is slower, so it is not used.
+
+#define CRC_BATCH_LANES     4U
+
+// Lanes of the interleaved kernel, every lane holds one message. When a lane reaches the end of its message
+// the result is written and the lane continues with the next message, so all lanes stay busy.
+template <class T>
+struct CrcBatchLanes
+{
+    const uint8_t *ptr[CRC_BATCH_LANES];
+    uint32_t remaining[CRC_BATCH_LANES];
+    uint32_t message[CRC_BATCH_LANES];
+    T crc[CRC_BATCH_LANES];
+};
+
+template <class T, bool RefIn>
+static void CalculateCRCBatch(const T crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, T crcResults[])
+{
+    typedef CrcKernel<T, RefIn, false, false> Kernel;
+    CrcBatchLanes<T> lanes;
+    uint32_t nextMessage = 0;
+    bool lanesFull = (nMessages >= CRC_BATCH_LANES);
+
+    for (uint32_t lane = 0; (lane < CRC_BATCH_LANES) && lanesFull; lane++)
+    {
+        lanes.ptr[lane] = crc_DataPtrs[nextMessage];
+        lanes.remaining[lane] = crc_Lengths[nextMessage];
+        lanes.message[lane] = nextMessage;
+        lanes.crc[lane] = crc_InitialValue;
+        nextMessage++;
+    }
+
+    while (lanesFull)
+    {
+        uint32_t length = lanes.remaining[0];
+
+        for (uint32_t lane = 1; lane < CRC_BATCH_LANES; lane++)
+        {
+            length = (lanes.remaining[lane] < length) ? lanes.remaining[lane] : length;
+        }
+
+        // length bytes of every lane, interleaved so the table loads of different lanes overlap
+        for (uint32_t ui32Counter = 0U; ui32Counter < length; ui32Counter++)
+        {
+            for (uint32_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+            {
+                lanes.crc[lane] = Kernel::Step(crcTable, lanes.ptr[lane][ui32Counter], lanes.crc[lane]);
+            }
+        }
+
+        // finished lanes take the next message, batch ends when a lane has nothing left to take
+        for (uint32_t lane = 0; lane < CRC_BATCH_LANES; lane++)
+        {
+            lanes.ptr[lane] += length;
+            lanes.remaining[lane] -= length;
+
+            while (lanesFull && (0 == lanes.remaining[lane]))
+            {
+                crcResults[lanes.message[lane]] = CrcFinalize<T>(lanes.crc[lane], crc_XorValue, reflectedOutput);
+
+                if (nextMessage < nMessages)
+                {
+                    lanes.ptr[lane] = crc_DataPtrs[nextMessage];
+                    lanes.remaining[lane] = crc_Lengths[nextMessage];
+                    lanes.message[lane] = nextMessage;
+                    lanes.crc[lane] = crc_InitialValue;
+                    nextMessage++;
+                }
+                else
+                {
+                    lanesFull = false;
+                    lanes.remaining[lane] = UINT32_MAX;  // marks lane as finished
+                }
+            }
+        }
+    }
+
+    // messages still in lanes and messages which did not fill all lanes
+    for (uint32_t lane = 0; (lane < CRC_BATCH_LANES) && (nMessages >= CRC_BATCH_LANES); lane++)
+    {
+        if (UINT32_MAX != lanes.remaining[lane])
+        {
+            T crc = Kernel::Update(crcTable, lanes.ptr[lane], lanes.remaining[lane], lanes.crc[lane]);
+            crcResults[lanes.message[lane]] = CrcFinalize<T>(crc, crc_XorValue, reflectedOutput);
+        }
+    }
+    for (; nextMessage < nMessages; nextMessage++)
+    {
+        T crc = Kernel::Update(crcTable, crc_DataPtrs[nextMessage], crc_Lengths[nextMessage], crc_InitialValue);
+        crcResults[nextMessage] = CrcFinalize<T>(crc, crc_XorValue, reflectedOutput);
+    }
+}
+
+// crcTable from Crc8TableGenerator(), parameters have the same meaning as for CalculateCRC8()
+void CalculateCRC8Batch(uint8_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint8_t crcResults[])
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_BATCH, CrcStatsLength(crc_Lengths, nMessages));
+
+    if (reflectedInput)
+    {
+        CalculateCRCBatch<uint8_t, true>(crcTable, crc_DataPtrs, crc_Lengths, nMessages, crc_InitialValue, crc_XorValue, reflectedOutput, crcResults);
+    }
+    else
+    {
+        CalculateCRCBatch<uint8_t, false>(crcTable, crc_DataPtrs, crc_Lengths, nMessages, crc_InitialValue, crc_XorValue, reflectedOutput, crcResults);
+    }
+}
+
+// crcTable from Crc16TableGenerator(), parameters have the same meaning as for CalculateCRC16()
+void CalculateCRC16Batch(uint16_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint16_t crcResults[])
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_BATCH, CrcStatsLength(crc_Lengths, nMessages));
+
+    if (reflectedInput)
+    {
+        CalculateCRCBatch<uint16_t, true>(crcTable, crc_DataPtrs, crc_Lengths, nMessages, crc_InitialValue, crc_XorValue, reflectedOutput, crcResults);
+    }
+    else
+    {
+        CalculateCRCBatch<uint16_t, false>(crcTable, crc_DataPtrs, crc_Lengths, nMessages, crc_InitialValue, crc_XorValue, reflectedOutput, crcResults);
+    }
+}
+
+// crcTable from Crc32TableGenerator(), parameters have the same meaning as for CalculateCRC32()
+void CalculateCRC32Batch(uint32_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint32_t crcResults[])
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_BATCH, CrcStatsLength(crc_Lengths, nMessages));
+
+    if (reflectedInput)
+    {
+        CalculateCRCBatch<uint32_t, true>(crcTable, crc_DataPtrs, crc_Lengths, nMessages, crc_InitialValue, crc_XorValue, reflectedOutput, crcResults);
+    }
+    else
+    {
+        CalculateCRCBatch<uint32_t, false>(crcTable, crc_DataPtrs, crc_Lengths, nMessages, crc_InitialValue, crc_XorValue, reflectedOutput, crcResults);
+    }
+}
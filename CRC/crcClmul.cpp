@@ -0,0 +1,436 @@
+#include <stdint.h>
+
+#include "crcStats.h"
+
+//Carry-less multiplication (PCLMULQDQ / VPCLMULQDQ) folding for CRCs of any width up to 64 bits.
+//Data is folded in 16 byte blocks down to one 16 byte remainder which has the same CRC as the folded data,
+//remainder and the last bytes are finished with the normal lookup table. There is no Barrett reduction,
+//so the same code works for every polynomial, only fold constants x^n mod P are polynomial specific.
+//
+//Based on: Intel "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CRC_CLMUL_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CRC_CLMUL_TARGET(x)
+#else
+#include <cpuid.h>
+#define CRC_CLMUL_TARGET(x) __attribute__((target(x)))
+#endif
+#endif
+
+// Buffers shorter than this are calculated with the lookup table only
+#define CRC_CLMUL_MIN_LENGTH    128U
+
+// Layout of clmulConstants[16] filled by CrcClmulConstantsGenerator()
+#define CRC_CLMUL_FOLD128       0U  // x^128, x^192 mod P
+#define CRC_CLMUL_FOLD512       2U  // x^512, x^576 mod P
+#define CRC_CLMUL_FOLD2048      4U  // x^2048, x^2112 mod P
+#define CRC_CLMUL_REFLECTED     6U  // same constants for reflected input
+#define CRC_CLMUL_WIDTH         12U
+
+extern uint8_t CalculateCRC8(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t reflect(uint32_t data, uint8_t nBits);
+
+// x^exponent mod P, P is polynomial of given width without the top bit
+static uint64_t CrcXPowModP(uint32_t exponent, uint64_t polynomial, uint8_t width)
+{
+    uint64_t topBit = (uint64_t)0x01 << (width - 1);
+    uint64_t mask = (topBit << 1) - 1;
+    uint64_t remainder = 0x01;
+
+    for (uint32_t i = 0; i < exponent; i++)
+    {
+        if (0 == (remainder & topBit))
+        {
+            remainder = (remainder << 1) & mask;
+        }
+        else
+        {
+            remainder = ((remainder << 1) & mask) ^ polynomial;
+        }
+    }
+
+    return remainder;
+}
+
+static uint64_t CrcReflect64(uint64_t data)
+{
+    return ((uint64_t)reflect((uint32_t)data, 32) << 32) | reflect((uint32_t)(data >> 32), 32);
+}
+
+void CrcClmulConstantsGenerator(uint64_t polynomial, uint8_t width, uint64_t clmulConstants[16])
+{
+    const uint32_t foldDistance[3] = { 128U, 512U, 2048U };
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        // low half of a block is moved by the fold distance, high half by 64 more bits
+        clmulConstants[2*i]     = CrcXPowModP(foldDistance[i], polynomial, width);
+        clmulConstants[2*i + 1] = CrcXPowModP(foldDistance[i] + 64U, polynomial, width);
+
+        // reflected block has high half in the low qword, reflected product is one bit short
+        clmulConstants[CRC_CLMUL_REFLECTED + 2*i]     = CrcReflect64(CrcXPowModP(foldDistance[i] + 63U, polynomial, width));
+        clmulConstants[CRC_CLMUL_REFLECTED + 2*i + 1] = CrcReflect64(CrcXPowModP(foldDistance[i] - 1U, polynomial, width));
+    }
+
+    clmulConstants[CRC_CLMUL_WIDTH] = width;
+}
+
+#ifdef CRC_CLMUL_X86
+
+static bool CrcClmulCpuid(uint32_t leaf, uint32_t subLeaf, uint32_t registers[4])
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subLeaf);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        registers[i] = (uint32_t)info[i];
+    }
+    return true;
+#else
+    return 0 != __get_cpuid_count(leaf, subLeaf, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+}
+
+CRC_CLMUL_TARGET("xsave")
+static uint64_t CrcClmulXgetbv()
+{
+    return _xgetbv(0);
+}
+
+// 0 - no carry-less multiply, 1 - PCLMULQDQ, 2 - VPCLMULQDQ with AVX-512
+static uint8_t CrcClmulDetect()
+{
+    uint32_t registers[4];
+    uint8_t level = 0;
+
+    if (CrcClmulCpuid(1, 0, registers) && (registers[2] & (1U << 1)) && (registers[2] & (1U << 9)))
+    {
+        level = 1;  // PCLMULQDQ and SSSE3
+
+        if ((registers[2] & (1U << 27)) && CrcClmulCpuid(7, 0, registers))
+        {
+            bool avx512Cpu = (registers[1] & (1U << 16)) && (registers[1] & (1U << 30)) && (registers[2] & (1U << 10));
+
+            // OS has to save opmask and zmm state
+            if (avx512Cpu && (0xE6 == (CrcClmulXgetbv() & 0xE6)))
+            {
+                level = 2;
+            }
+        }
+    }
+
+    return level;
+}
+
+static uint8_t CrcClmulLevel()
+{
+    static const uint8_t level = CrcClmulDetect();
+    return level;
+}
+
+static bool CrcAvx2Detect()
+{
+    uint32_t registers[4];
+
+    // OS has to save ymm state
+    if (CrcClmulCpuid(1, 0, registers) && (registers[2] & (1U << 27)) && (0x06 == (CrcClmulXgetbv() & 0x06)))
+    {
+        return CrcClmulCpuid(7, 0, registers) && (registers[1] & (1U << 5));
+    }
+    return false;
+}
+
+CRC_CLMUL_TARGET("pclmul,ssse3")
+static inline __m128i CrcClmulFold128(__m128i block, __m128i constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(block, constants, 0x00), _mm_clmulepi64_si128(block, constants, 0x11));
+}
+
+CRC_CLMUL_TARGET("pclmul,ssse3")
+static inline __m128i CrcClmulLoad(const uint8_t *crc_DataPtr, __m128i byteSwap, bool reflectedInput)
+{
+    __m128i block = _mm_loadu_si128((const __m128i *)crc_DataPtr);
+
+    if (!reflectedInput)
+    {
+        block = _mm_shuffle_epi8(block, byteSwap);
+    }
+    return block;
+}
+
+CRC_CLMUL_TARGET("pclmul,ssse3")
+static __m128i CrcClmulFoldSse(const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, __m128i first, bool reflectedInput)
+{
+    const uint64_t *constants = &clmulConstants[reflectedInput ? CRC_CLMUL_REFLECTED : 0U];
+    __m128i byteSwap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i fold128 = _mm_loadu_si128((const __m128i *)&constants[CRC_CLMUL_FOLD128]);
+    __m128i fold512 = _mm_loadu_si128((const __m128i *)&constants[CRC_CLMUL_FOLD512]);
+    __m128i x0, x1, x2, x3;
+
+    // four independent accumulators, 64 bytes per step
+    x0 = first;
+    x1 = CrcClmulLoad(crc_DataPtr + 16, byteSwap, reflectedInput);
+    x2 = CrcClmulLoad(crc_DataPtr + 32, byteSwap, reflectedInput);
+    x3 = CrcClmulLoad(crc_DataPtr + 48, byteSwap, reflectedInput);
+    crc_DataPtr += 64;
+    crc_Length -= 64;
+
+    while (crc_Length >= 64)
+    {
+        x0 = _mm_xor_si128(CrcClmulFold128(x0, fold512), CrcClmulLoad(crc_DataPtr, byteSwap, reflectedInput));
+        x1 = _mm_xor_si128(CrcClmulFold128(x1, fold512), CrcClmulLoad(crc_DataPtr + 16, byteSwap, reflectedInput));
+        x2 = _mm_xor_si128(CrcClmulFold128(x2, fold512), CrcClmulLoad(crc_DataPtr + 32, byteSwap, reflectedInput));
+        x3 = _mm_xor_si128(CrcClmulFold128(x3, fold512), CrcClmulLoad(crc_DataPtr + 48, byteSwap, reflectedInput));
+        crc_DataPtr += 64;
+        crc_Length -= 64;
+    }
+
+    x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), x1);
+    x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), x2);
+    x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), x3);
+
+    while (crc_Length >= 16)
+    {
+        x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), CrcClmulLoad(crc_DataPtr, byteSwap, reflectedInput));
+        crc_DataPtr += 16;
+        crc_Length -= 16;
+    }
+
+    return x0;
+}
+
+CRC_CLMUL_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+static inline __m512i CrcClmulFold512(__m512i block, __m512i constants)
+{
+    return _mm512_xor_si512(_mm512_clmulepi64_epi128(block, constants, 0x00), _mm512_clmulepi64_epi128(block, constants, 0x11));
+}
+
+CRC_CLMUL_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+static inline __m512i CrcClmulLoad512(const uint8_t *crc_DataPtr, __m512i byteSwap, bool reflectedInput)
+{
+    __m512i block = _mm512_loadu_si512((const void *)crc_DataPtr);
+
+    if (!reflectedInput)
+    {
+        block = _mm512_shuffle_epi8(block, byteSwap);
+    }
+    return block;
+}
+
+CRC_CLMUL_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+static __m128i CrcClmulFoldAvx512(const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, __m128i first, bool reflectedInput)
+{
+    const uint64_t *constants = &clmulConstants[reflectedInput ? CRC_CLMUL_REFLECTED : 0U];
+    __m512i byteSwap = _mm512_set_epi64(0x0001020304050607, 0x08090A0B0C0D0E0F, 0x0001020304050607, 0x08090A0B0C0D0E0F,
+                                        0x0001020304050607, 0x08090A0B0C0D0E0F, 0x0001020304050607, 0x08090A0B0C0D0E0F);
+    __m512i fold512 = _mm512_set_epi64((long long)constants[CRC_CLMUL_FOLD512 + 1], (long long)constants[CRC_CLMUL_FOLD512],
+                                       (long long)constants[CRC_CLMUL_FOLD512 + 1], (long long)constants[CRC_CLMUL_FOLD512],
+                                       (long long)constants[CRC_CLMUL_FOLD512 + 1], (long long)constants[CRC_CLMUL_FOLD512],
+                                       (long long)constants[CRC_CLMUL_FOLD512 + 1], (long long)constants[CRC_CLMUL_FOLD512]);
+    __m512i fold2048 = _mm512_set_epi64((long long)constants[CRC_CLMUL_FOLD2048 + 1], (long long)constants[CRC_CLMUL_FOLD2048],
+                                        (long long)constants[CRC_CLMUL_FOLD2048 + 1], (long long)constants[CRC_CLMUL_FOLD2048],
+                                        (long long)constants[CRC_CLMUL_FOLD2048 + 1], (long long)constants[CRC_CLMUL_FOLD2048],
+                                        (long long)constants[CRC_CLMUL_FOLD2048 + 1], (long long)constants[CRC_CLMUL_FOLD2048]);
+    __m128i fold128 = _mm_loadu_si128((const __m128i *)&constants[CRC_CLMUL_FOLD128]);
+    __m512i z0, z1, z2, z3;
+    __m128i lanes[4];
+    __m128i x0;
+
+    // four independent 512 bit accumulators, 256 bytes per step
+    z0 = _mm512_mask_blend_epi64(0x03, CrcClmulLoad512(crc_DataPtr, byteSwap, reflectedInput), _mm512_castsi128_si512(first));
+    z1 = CrcClmulLoad512(crc_DataPtr + 64, byteSwap, reflectedInput);
+    z2 = CrcClmulLoad512(crc_DataPtr + 128, byteSwap, reflectedInput);
+    z3 = CrcClmulLoad512(crc_DataPtr + 192, byteSwap, reflectedInput);
+    crc_DataPtr += 256;
+    crc_Length -= 256;
+
+    while (crc_Length >= 256)
+    {
+        z0 = _mm512_xor_si512(CrcClmulFold512(z0, fold2048), CrcClmulLoad512(crc_DataPtr, byteSwap, reflectedInput));
+        z1 = _mm512_xor_si512(CrcClmulFold512(z1, fold2048), CrcClmulLoad512(crc_DataPtr + 64, byteSwap, reflectedInput));
+        z2 = _mm512_xor_si512(CrcClmulFold512(z2, fold2048), CrcClmulLoad512(crc_DataPtr + 128, byteSwap, reflectedInput));
+        z3 = _mm512_xor_si512(CrcClmulFold512(z3, fold2048), CrcClmulLoad512(crc_DataPtr + 192, byteSwap, reflectedInput));
+        crc_DataPtr += 256;
+        crc_Length -= 256;
+    }
+
+    z0 = _mm512_xor_si512(CrcClmulFold512(z0, fold512), z1);
+    z0 = _mm512_xor_si512(CrcClmulFold512(z0, fold512), z2);
+    z0 = _mm512_xor_si512(CrcClmulFold512(z0, fold512), z3);
+
+    while (crc_Length >= 64)
+    {
+        z0 = _mm512_xor_si512(CrcClmulFold512(z0, fold512), CrcClmulLoad512(crc_DataPtr, byteSwap, reflectedInput));
+        crc_DataPtr += 64;
+        crc_Length -= 64;
+    }
+
+    // four 128 bit lanes to one block, lane 0 is the oldest data
+    _mm512_storeu_si512((void *)lanes, z0);
+    x0 = lanes[0];
+    x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), lanes[1]);
+    x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), lanes[2]);
+    x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), lanes[3]);
+
+    __m128i byteSwap128 = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    while (crc_Length >= 16)
+    {
+        x0 = _mm_xor_si128(CrcClmulFold128(x0, fold128), CrcClmulLoad(crc_DataPtr, byteSwap128, reflectedInput));
+        crc_DataPtr += 16;
+        crc_Length -= 16;
+    }
+
+    return x0;
+}
+
+// Folds crc_Length bytes (multiple of 16, at least 64) to 16 bytes in folded[], crc_Register is xored into the first bytes.
+// Table CRC of folded[] with zero initial value equals table CRC of the data with crc_Register as initial value.
+CRC_CLMUL_TARGET("pclmul,ssse3")
+static void CrcClmulFold(const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_Register, bool reflectedInput, uint8_t folded[16])
+{
+    __m128i byteSwap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    __m128i first = CrcClmulLoad(crc_DataPtr, byteSwap, reflectedInput);
+    __m128i result;
+
+    if (reflectedInput)
+    {
+        first = _mm_xor_si128(first, _mm_set_epi64x(0, (long long)crc_Register));
+    }
+    else
+    {
+        first = _mm_xor_si128(first, _mm_set_epi64x((long long)(crc_Register << (64U - clmulConstants[CRC_CLMUL_WIDTH])), 0));
+    }
+
+    if ((2 == CrcClmulLevel()) && (crc_Length >= 256))
+    {
+        result = CrcClmulFoldAvx512(clmulConstants, crc_DataPtr, crc_Length, first, reflectedInput);
+    }
+    else
+    {
+        result = CrcClmulFoldSse(clmulConstants, crc_DataPtr, crc_Length, first, reflectedInput);
+    }
+
+    if (!reflectedInput)
+    {
+        result = _mm_shuffle_epi8(result, byteSwap);
+    }
+    _mm_storeu_si128((__m128i *)folded, result);
+}
+
+#endif /* CRC_CLMUL_X86 */
+
+bool CrcClmulAvailable()
+{
+#ifdef CRC_CLMUL_X86
+    return 0 != CrcClmulLevel();
+#else
+    return false;
+#endif
+}
+
+// Used by the multi message kernels in crcBatch.cpp
+bool CrcAvx2Available()
+{
+#ifdef CRC_CLMUL_X86
+    static const bool available = CrcAvx2Detect();
+    return available;
+#else
+    return false;
+#endif
+}
+
+// clmulConstants has to be generated by CrcClmulConstantsGenerator() with the table polynomial and width 8
+uint8_t CalculateCRC8Clmul(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_CLMUL, crc_Length);
+
+#ifdef CRC_CLMUL_X86
+    if ((crc_Length >= CRC_CLMUL_MIN_LENGTH) && CrcClmulAvailable())
+    {
+        uint8_t folded[16];
+        uint32_t foldLength = crc_Length & ~0x0FU;
+        uint64_t crcRegister = reflectedInput ? reflect(crc_InitialValue, 8) : crc_InitialValue;
+
+        CrcClmulFold(clmulConstants, crc_DataPtr, foldLength, crcRegister, reflectedInput, folded);
+        uint8_t crc = CalculateCRC8(crcTable, folded, 16, 0, 0, false, reflectedInput);
+        return CalculateCRC8(crcTable, crc_DataPtr + foldLength, crc_Length - foldLength, crc, crc_XorValue, reflectedOutput, reflectedInput);
+    }
+#else
+    (void)clmulConstants;
+#endif
+    return CalculateCRC8(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// clmulConstants has to be generated by CrcClmulConstantsGenerator() with the table polynomial and width 16
+uint16_t CalculateCRC16Clmul(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_CLMUL, crc_Length);
+
+#ifdef CRC_CLMUL_X86
+    if ((crc_Length >= CRC_CLMUL_MIN_LENGTH) && CrcClmulAvailable())
+    {
+        uint8_t folded[16];
+        uint32_t foldLength = crc_Length & ~0x0FU;
+        uint64_t crcRegister = reflectedInput ? reflect(crc_InitialValue, 16) : crc_InitialValue;
+
+        CrcClmulFold(clmulConstants, crc_DataPtr, foldLength, crcRegister, reflectedInput, folded);
+        uint16_t crc = CalculateCRC16(crcTable, folded, 16, 0, 0, false, reflectedInput);
+        return CalculateCRC16(crcTable, crc_DataPtr + foldLength, crc_Length - foldLength, crc, crc_XorValue, reflectedOutput, reflectedInput);
+    }
+#else
+    (void)clmulConstants;
+#endif
+    return CalculateCRC16(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// clmulConstants has to be generated by CrcClmulConstantsGenerator() with the table polynomial and width 32
+uint32_t CalculateCRC32Clmul(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_CLMUL, crc_Length);
+
+#ifdef CRC_CLMUL_X86
+    if ((crc_Length >= CRC_CLMUL_MIN_LENGTH) && CrcClmulAvailable())
+    {
+        uint8_t folded[16];
+        uint32_t foldLength = crc_Length & ~0x0FU;
+        uint64_t crcRegister = reflectedInput ? reflect(crc_InitialValue, 32) : crc_InitialValue;
+
+        CrcClmulFold(clmulConstants, crc_DataPtr, foldLength, crcRegister, reflectedInput, folded);
+        uint32_t crc = CalculateCRC32(crcTable, folded, 16, 0, 0, false, reflectedInput);
+        return CalculateCRC32(crcTable, crc_DataPtr + foldLength, crc_Length - foldLength, crc, crc_XorValue, reflectedOutput, reflectedInput);
+    }
+#else
+    (void)clmulConstants;
+#endif
+    return CalculateCRC32(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// clmulConstants has to be generated by CrcClmulConstantsGenerator() with the table polynomial and width 64
+uint64_t CalculateCRC64Clmul(uint64_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC64, CRC_STATS_CLMUL, crc_Length);
+
+#ifdef CRC_CLMUL_X86
+    if ((crc_Length >= CRC_CLMUL_MIN_LENGTH) && CrcClmulAvailable())
+    {
+        uint8_t folded[16];
+        uint32_t foldLength = crc_Length & ~0x0FU;
+        uint64_t crcRegister = reflectedInput ? CrcReflect64(crc_InitialValue) : crc_InitialValue;
+
+        CrcClmulFold(clmulConstants, crc_DataPtr, foldLength, crcRegister, reflectedInput, folded);
+        uint64_t crc = CalculateCRC64(crcTable, folded, 16, 0, 0, false, reflectedInput);
+        return CalculateCRC64(crcTable, crc_DataPtr + foldLength, crc_Length - foldLength, crc, crc_XorValue, reflectedOutput, reflectedInput);
+    }
+#else
+    (void)clmulConstants;
+#endif
+    return CalculateCRC64(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
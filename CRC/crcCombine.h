@@ -0,0 +1,159 @@
+#ifndef CRC_COMBINE_H
+#define CRC_COMBINE_H
+
+#include <stdint.h>
+
+#include "crcKernel.h"
+
+//CRC of concatenated data from CRCs of the parts, without reading the data again.
+//CRC register is linear: appending n bytes to A multiplies A's register by x^(8n) mod P and adds register of the
+//new bytes. x^(8n) mod P is calculated by square and multiply in O(log n) polynomial multiplications.
+//
+//All values are in the meaning of CalculateCRC(): crc_InitialValue is the normal (MSB first) register value,
+//crc_XorValue is applied before output reflection. Input reflection does not change the result of combining.
+//CRCs narrower than T (e.g. CRC-15/CAN in uint16_t) give the width argument like CalculateCRC(), the values are
+//left aligned inside and the result is right aligned again.
+
+// a * b mod P, P is polynomial of width 8*sizeof(T) without the top bit
+template <class T>
+constexpr T CrcMultiplyModP(T a, T b, T polynomial)
+{
+    T topBit = (T)(0x01ULL << (8*sizeof(T) - 1));
+    T product = 0;
+
+    for (int8_t bit = 8*sizeof(T) - 1; bit >= 0; bit--)
+    {
+        if (0 == (product & topBit))
+        {
+            product = (T)(product << 1);
+        }
+        else
+        {
+            product = (T)(product << 1) ^ polynomial;
+        }
+
+        if ((b >> bit) & 0x01)
+        {
+            product ^= a;
+        }
+    }
+
+    return product;
+}
+
+// x^(8*nBytes) mod P
+template <class T>
+constexpr T CrcXPow8nModP(uint64_t nBytes, T polynomial)
+{
+    T result = 0x01;
+    T power = (8 == 8*sizeof(T)) ? polynomial : (T)(0x01ULL << 8);  // x^8 mod P
+
+    while (0 != nBytes)
+    {
+        if (nBytes & 0x01)
+        {
+            result = CrcMultiplyModP<T>(result, power, polynomial);
+        }
+        power = CrcMultiplyModP<T>(power, power, polynomial);
+        nBytes >>= 1;
+    }
+
+    return result;
+}
+
+// Register value after nBytes zero bytes, same as CalculateCRC() over zeros without xor and reflection
+template <class T>
+constexpr T CrcShift(T crc, uint64_t nBytes, T polynomial, uint8_t width = 8*sizeof(T))
+{
+    // x^s * (x^width + P) as modulus keeps the left aligned register a multiple of x^s, s = 8*sizeof(T) - width
+    polynomial = CrcAlignLeft<T>(polynomial, width);
+    crc = CrcMultiplyModP<T>(CrcAlignLeft<T>(crc, width), CrcXPow8nModP<T>(nBytes, polynomial), polynomial);
+    return CrcAlignRight<T>(crc, width, false);
+}
+
+// Result of CalculateCRC() with width argument back to the value of a left aligned register, see CrcAlignRight()
+template <class T>
+constexpr T CrcAlignResultLeft(T crc, uint8_t width, bool reflectedOutput)
+{
+    return reflectedOutput ? crc : CrcAlignLeft<T>(crc, width);
+}
+
+// Final CRC value back to the normal register value
+template <class T>
+constexpr T CrcUnfinalize(T crc, T crc_XorValue, bool reflectedOutput)
+{
+    if (reflectedOutput)
+    {
+        crc = (T)CrcReflectValue(crc, 8*sizeof(T));
+    }
+    return crc ^ crc_XorValue;
+}
+
+template <class T>
+constexpr T CrcFinalize(T crc, T crc_XorValue, bool reflectedOutput)
+{
+    crc ^= crc_XorValue;
+    if (reflectedOutput)
+    {
+        crc = (T)CrcReflectValue(crc, 8*sizeof(T));
+    }
+    return crc;
+}
+
+// CRC of nBytes zero bytes
+template <class T>
+constexpr T CalculateCRCZeros(uint64_t nBytes, T polynomial, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, uint8_t width = 8*sizeof(T))
+{
+    T crcRegister = CrcAlignLeft<T>(CrcShift<T>(crc_InitialValue, nBytes, polynomial, width), width);
+
+    return CrcAlignRight<T>(CrcFinalize<T>(crcRegister, CrcAlignLeft<T>(crc_XorValue, width), reflectedOutput), width, reflectedOutput);
+}
+
+// CRC of A followed by B from crcA, crcB and the length of B
+template <class T>
+constexpr T CrcCombine(T crcA, T crcB, uint64_t lengthB, T polynomial, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, uint8_t width = 8*sizeof(T))
+{
+    T xorValue = CrcAlignLeft<T>(crc_XorValue, width);
+    T registerA = CrcUnfinalize<T>(CrcAlignResultLeft<T>(crcA, width, reflectedOutput), xorValue, reflectedOutput);
+    T registerB = CrcUnfinalize<T>(CrcAlignResultLeft<T>(crcB, width, reflectedOutput), xorValue, reflectedOutput);
+
+    // B was started from crc_InitialValue, A's register takes its place
+    T shifted = CrcAlignLeft<T>(CrcShift<T>(CrcAlignRight<T>(registerA ^ CrcAlignLeft<T>(crc_InitialValue, width), width, false), lengthB, polynomial, width), width);
+
+    return CrcAlignRight<T>(CrcFinalize<T>(shifted ^ registerB, xorValue, reflectedOutput), width, reflectedOutput);
+}
+
+// CRC of data in which crc_Length bytes at crcOffset changed from oldData to newData, totalLength is the length of
+// the whole data and crc its CRC before the change. Only the changed bytes are read: CRC of the xor of old and new
+// bytes (without initial value) is shifted over the bytes after them and added to the old register.
+// crcTable is the normal table from CrcTableGenerator() with the same width, other parameters have the same meaning
+// as for CalculateCRC().
+template <class T>
+constexpr T CrcUpdateInPlace(const T crcTable[256], T crc, uint64_t totalLength, uint64_t crcOffset, const uint8_t *oldData, const uint8_t *newData, uint32_t crc_Length,
+                             T polynomial, T crc_XorValue, bool reflectedOutput, bool reflectedInput, uint8_t width = 8*sizeof(T))
+{
+    T delta = 0;
+
+    for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+    {
+        uint8_t data = oldData[ui32Counter] ^ newData[ui32Counter];
+
+        if (reflectedInput)
+        {
+            delta = CrcKernel<T, true, false, false>::Step(crcTable, data, delta);
+        }
+        else
+        {
+            delta = CrcKernel<T, false, false, false>::Step(crcTable, data, delta);
+        }
+    }
+
+    // delta is left aligned like the table entries
+    T xorValue = CrcAlignLeft<T>(crc_XorValue, width);
+    T crcRegister = CrcUnfinalize<T>(CrcAlignResultLeft<T>(crc, width, reflectedOutput), xorValue, reflectedOutput);
+    T shifted = CrcAlignLeft<T>(CrcShift<T>(CrcAlignRight<T>(delta, width, false), totalLength - crcOffset - crc_Length, polynomial, width), width);
+
+    return CrcAlignRight<T>(CrcFinalize<T>(crcRegister ^ shifted, xorValue, reflectedOutput), width, reflectedOutput);
+}
+
+#endif /* CRC_COMBINE_H */
@@ -0,0 +1,235 @@
+#include <stdint.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "crcHamming.h"
+#include "crcKernel.h"
+#include "crcThreadPool.h"
+
+// Values of d per thread pool task
+#define CRC_HAMMING_TASK_SIZE       256U
+
+#define CRC_HAMMING_NO_POSITION     0xFFFFFFFFU
+
+// Syndrome to bit position with open addressing, syndromes are unique below the period of x mod P
+class CrcHammingPositions
+{
+public:
+    CrcHammingPositions(const std::vector<uint64_t> &syndromes, uint32_t nPositions)
+    {
+        uint8_t nBits = 1;
+        while ((1ULL << nBits) < 2ULL * nPositions)
+        {
+            nBits++;
+        }
+        shift = 64 - nBits;
+        mask = (1ULL << nBits) - 1U;
+        keys.resize(1ULL << nBits);
+        positions.resize(1ULL << nBits, CRC_HAMMING_NO_POSITION);
+
+        for (uint32_t i = 0; i < nPositions; i++)
+        {
+            size_t slot = Slot(syndromes[i]);
+            while (CRC_HAMMING_NO_POSITION != positions[slot])
+            {
+                slot = (slot + 1) & mask;
+            }
+            keys[slot] = syndromes[i];
+            positions[slot] = i;
+        }
+    }
+
+    // CRC_HAMMING_NO_POSITION if no position has the syndrome
+    uint32_t Find(uint64_t syndrome) const
+    {
+        for (size_t slot = Slot(syndrome); ; slot = (slot + 1) & mask)
+        {
+            if ((CRC_HAMMING_NO_POSITION == positions[slot]) || (keys[slot] == syndrome))
+            {
+                return positions[slot];
+            }
+        }
+    }
+
+private:
+    size_t Slot(uint64_t syndrome) const
+    {
+        return (size_t)((syndrome * 0x9E3779B97F4A7C15ULL) >> shift);
+    }
+
+    std::vector<uint64_t> keys;
+    std::vector<uint32_t> positions;
+    uint8_t shift;
+    size_t mask;
+};
+
+// x^i mod P left aligned in 64 bits for i < nPositions, 8 positions per table step
+static std::vector<uint64_t> CrcHammingSyndromes(uint8_t width, uint64_t polynomial, uint32_t nPositions)
+{
+    uint64_t alignedPolynomial = CrcAlignLeft<uint64_t>(polynomial, width);
+    uint64_t crcTable[256];
+    std::vector<uint64_t> syndromes(nPositions);
+
+    CrcTableGenerator<uint64_t>(alignedPolynomial, crcTable);
+
+    uint64_t syndrome = CrcAlignLeft<uint64_t>(0x01, width);
+    for (uint32_t i = 0; i < std::min<uint32_t>(nPositions, 8U); i++)
+    {
+        syndromes[i] = syndrome;
+        syndrome = (syndrome << 1) ^ (alignedPolynomial & (0 - (syndrome >> 63)));
+    }
+    for (uint32_t i = 8; i < nPositions; i++)
+    {
+        syndromes[i] = (syndromes[i - 8] << 8) ^ crcTable[syndromes[i - 8] >> 56];
+    }
+
+    return syndromes;
+}
+
+// B_w(d): undetected errors of weight w with the lowest bit at 0 and the highest at d
+static uint64_t CrcHammingCount(const std::vector<uint64_t> &syndromes, const CrcHammingPositions *positions, uint8_t weight, uint32_t d)
+{
+    uint64_t target = syndromes[0] ^ syndromes[d];
+    uint64_t count = 0;
+
+    if (2 == weight)
+    {
+        count = (0 == target);
+    }
+    else if (3 == weight)
+    {
+        uint32_t k = positions->Find(target);
+        count = (k > 0) && (k < d);
+    }
+    else if (4 == weight)
+    {
+        for (uint32_t i = 1; i < d; i++)
+        {
+            uint32_t j = positions->Find(target ^ syndromes[i]);
+            count += (j > i) && (j < d);
+        }
+    }
+    else
+    {
+        for (uint32_t i = 1; i < d; i++)
+        {
+            for (uint32_t j = i + 1; j < d; j++)
+            {
+                uint32_t k = positions->Find(target ^ syndromes[i] ^ syndromes[j]);
+                count += (k > j) && (k < d);
+            }
+        }
+    }
+
+    return count;
+}
+
+bool CrcHammingEvaluate(uint8_t width, uint64_t polynomial, const uint32_t dataBits[], uint32_t nLengths, CrcHammingResult results[])
+{
+    if ((width < 3) || (width > 64) || (0 == (polynomial & 0x01)) || ((width < 64) && (0 != (polynomial >> width))))
+    {
+        return false;
+    }
+
+    uint64_t maxDataBits = 0;
+    for (uint32_t i = 0; i < nLengths; i++)
+    {
+        maxDataBits = std::max<uint64_t>(maxDataBits, dataBits[i]);
+    }
+    if (maxDataBits + width >= CRC_HAMMING_NO_POSITION)
+    {
+        return false;
+    }
+
+    uint32_t nPositions = (uint32_t)maxDataBits + width;
+    std::vector<uint64_t> syndromes = CrcHammingSyndromes(width, polynomial, nPositions);
+
+    // P(1) = 0: every error of odd weight is detected
+    bool evenOnly = (0 != (__builtin_popcountll(polynomial) & 0x01));
+
+    // sum of B_w(d) and of d * B_w(d) over d < n, evaluated up to limits[w]
+    std::vector<uint64_t> countSums[CRC_HAMMING_MAX_WEIGHT + 1];
+    std::vector<uint64_t> weightedSums[CRC_HAMMING_MAX_WEIGHT + 1];
+    uint32_t limits[CRC_HAMMING_MAX_WEIGHT + 1] = { 0 };
+    uint32_t bound = nPositions;
+    std::unique_ptr<CrcHammingPositions> positions;
+
+    for (uint8_t weight = 2; weight <= CRC_HAMMING_MAX_WEIGHT; weight++)
+    {
+        if (evenOnly && (0 != (weight & 0x01)))
+        {
+            continue;
+        }
+
+        // positions below the first undetected error of weight 2, where syndromes are unique
+        if ((3 <= weight) && (nullptr == positions))
+        {
+            positions.reset(new CrcHammingPositions(syndromes, bound));
+        }
+
+        std::vector<uint64_t> counts(bound, 0);
+        CrcTaskGroup group(CrcThreadPool::Shared());
+
+        for (uint32_t first = 1; first < bound; first += CRC_HAMMING_TASK_SIZE)
+        {
+            group.Run([&, first]()
+            {
+                uint32_t last = std::min<uint32_t>(first + CRC_HAMMING_TASK_SIZE, bound);
+                for (uint32_t d = first; d < last; d++)
+                {
+                    counts[d] = CrcHammingCount(syndromes, positions.get(), weight, d);
+                }
+            });
+        }
+        group.Wait();
+
+        limits[weight] = bound;
+        countSums[weight].assign(bound + 1, 0);
+        weightedSums[weight].assign(bound + 1, 0);
+        for (uint32_t d = 0; d < bound; d++)
+        {
+            countSums[weight][d + 1] = countSums[weight][d] + counts[d];
+            weightedSums[weight][d + 1] = weightedSums[weight][d] + d * counts[d];
+        }
+
+        // higher weights are only needed for codewords without an undetected error of this weight
+        for (uint32_t d = 0; d < limits[weight]; d++)
+        {
+            if (0 != counts[d])
+            {
+                bound = d;
+                break;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < nLengths; i++)
+    {
+        uint64_t n = (uint64_t)dataBits[i] + width;
+
+        results[i].dataBits = dataBits[i];
+        results[i].hammingDistance = CRC_HAMMING_MAX_WEIGHT + 1;
+        results[i].undetected = 0;
+
+        for (uint8_t weight = 2; weight <= CRC_HAMMING_MAX_WEIGHT; weight++)
+        {
+            if (0 == limits[weight])
+            {
+                continue;
+            }
+
+            // n is at most limits[weight] if all lower weights are detected
+            uint32_t end = (uint32_t)std::min<uint64_t>(n, limits[weight]);
+            uint64_t undetected = n * countSums[weight][end] - weightedSums[weight][end];
+            if (0 != undetected)
+            {
+                results[i].hammingDistance = weight;
+                results[i].undetected = undetected;
+                break;
+            }
+        }
+    }
+
+    return true;
+}
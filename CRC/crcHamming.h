@@ -0,0 +1,33 @@
+#ifndef CRC_HAMMING_H
+#define CRC_HAMMING_H
+
+#include <stdint.h>
+
+//Error detection of a CRC polynomial: Hamming distance (HD) and number of undetected errors for data lengths.
+//
+//An error of weight w is undetected if the syndromes x^i mod P of its w bit positions xor to zero. P has the x^0
+//term, so every undetected error shifted down to bit 0 stays undetected: counting the ones which start at bit 0 and
+//end at bit d gives B_w(d), and the count for codeword length n is the sum of B_w(d) * (n - d) over d < n.
+//
+//Syndromes come from the byte table of CrcTableGenerator(), 8 positions per step. B_w(d) is found with a syndrome
+//to position table for the last bit: O(1) per d for weight 3, O(d) for weight 4, O(d^2) for weight 5. The values of
+//d are independent and are split over the shared thread pool. Weights are evaluated from 2 up and only below the
+//first length of a lower weight, odd weights are skipped for polynomials with factor x+1 (they detect all of them).
+//
+//Weights up to CRC_HAMMING_MAX_WEIGHT are counted, a higher Hamming distance is reported as
+//CRC_HAMMING_MAX_WEIGHT + 1 (at least).
+
+#define CRC_HAMMING_MAX_WEIGHT  5U
+
+struct CrcHammingResult
+{
+    uint32_t dataBits;          // message length without CRC
+    uint8_t hammingDistance;    // CRC_HAMMING_MAX_WEIGHT + 1 means at least that
+    uint64_t undetected;        // undetected errors of weight hammingDistance over data and CRC bits, 0 above CRC_HAMMING_MAX_WEIGHT
+};
+
+// Polynomial of width bits in normal form without the top bit, it must have the x^0 term. Results of dataBits[i]
+// are written to results[i]. Returns false for invalid parameters.
+bool CrcHammingEvaluate(uint8_t width, uint64_t polynomial, const uint32_t dataBits[], uint32_t nLengths, CrcHammingResult results[]);
+
+#endif /* CRC_HAMMING_H */
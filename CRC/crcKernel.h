@@ -0,0 +1,619 @@
+#ifndef CRC_KERNEL_H
+#define CRC_KERNEL_H
+
+#include <stdint.h>
+
+//This source code is helper for implementing CRC by AutoSar documentation: Specification of CRC Routines.
+// https://www.autosar.org/fileadmin/files/standards/classic/
+
+//Table generators and CRC kernels for CRC8, CRC16, CRC32 and CRC64. Width, input/output reflection and final xor
+//are template parameters of the kernels, so every combination has its own byte loop without runtime flags.
+//CalculateCRC() and CalculateCRC8/16/32/64() only select the kernel once per call.
+//
+//Other widths from 3 to 64 bits (e.g. CRC-15/CAN, CRC-17/CAN-FD, CRC-21/CAN-FD) use the smallest of uint8_t,
+//uint16_t, uint32_t and uint64_t which holds them and the width argument of the table generators and
+//CalculateCRC(). The register is kept left aligned in T, so the same byte kernels and tables are used.
+
+template <class T>
+struct CrcTable
+{
+    T entry[256];
+};
+
+// One fragment of a message which is not contiguous in memory (iovec)
+struct CrcSegment
+{
+    const uint8_t *crc_DataPtr;
+    uint32_t crc_Length;
+};
+
+// Reflect lower nBits about their center bit, bits above are dropped
+constexpr uint64_t CrcReflectValue(uint64_t data, uint8_t nBits)
+{
+    data = ((data >> 1)  & 0x5555555555555555ULL) | ((data & 0x5555555555555555ULL) << 1);
+    data = ((data >> 2)  & 0x3333333333333333ULL) | ((data & 0x3333333333333333ULL) << 2);
+    data = ((data >> 4)  & 0x0F0F0F0F0F0F0F0FULL) | ((data & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    data = ((data >> 8)  & 0x00FF00FF00FF00FFULL) | ((data & 0x00FF00FF00FF00FFULL) << 8);
+    data = ((data >> 16) & 0x0000FFFF0000FFFFULL) | ((data & 0x0000FFFF0000FFFFULL) << 16);
+    data = (data >> 32) | (data << 32);
+
+    return (0U == nBits) ? 0U : (data >> (64U - nBits));
+}
+
+constexpr CrcTable<uint8_t> CrcByteReflectionTableGenerator()
+{
+    CrcTable<uint8_t> reflectionTable = {};
+
+    for (uint32_t ui32Byte = 0; ui32Byte < 256; ui32Byte++)
+    {
+        reflectionTable.entry[ui32Byte] = (uint8_t)CrcReflectValue(ui32Byte, 8);
+    }
+
+    return reflectionTable;
+}
+
+// Input byte reflection for kernels with normal table and reflected input, one load instead of reflect() call
+inline constexpr CrcTable<uint8_t> crcByteReflection = CrcByteReflectionTableGenerator();
+
+// Polynomial, initial value or xor value of a width bit CRC moved to the top bits of T
+template <class T>
+constexpr T CrcAlignLeft(T value, uint8_t width)
+{
+    return (T)((uint64_t)value << (8*sizeof(T) - width));
+}
+
+// Result of a kernel with left aligned register back to width bits. Reflected output of the left aligned
+// register is already in the low bits.
+template <class T>
+constexpr T CrcAlignRight(T crc, uint8_t width, bool reflectedOutput)
+{
+    return reflectedOutput ? crc : (T)(crc >> (8*sizeof(T) - width));
+}
+
+// width is the CRC width in bits for CRCs narrower than T, table entries are left aligned.
+// tools/crcGenerate.cpp writes the tables of a model as const arrays for targets without generation at startup.
+template <class T>
+constexpr void CrcTableGenerator(T polynomial, T crcTable[256], uint8_t width = 8*sizeof(T))
+{
+    T remainder = 0;
+
+    polynomial = CrcAlignLeft<T>(polynomial, width);
+
+    T topBit = (T)(0x01ULL << (8*sizeof(T) - 1));
+    uint32_t ui32Dividend = 0;
+
+    for (ui32Dividend = 0; ui32Dividend  < 256; ui32Dividend++)
+    {
+        remainder = (T)((uint64_t)ui32Dividend << (8*sizeof(T) - 8));
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if (0 == (remainder & topBit))
+            {
+                remainder <<= 1;
+            }
+            else
+            {
+                remainder = (remainder << 1) ^ polynomial;
+            }
+        }
+
+        crcTable[ui32Dividend] = remainder;
+    }
+}
+
+// Lookup table for reflected (LSB first) algorithm, polynomial is given in the normal MSB first form.
+// Table index is the reflected input byte, no reflect() call is needed per data byte.
+template <class T>
+constexpr void CrcReflectedTableGenerator(T polynomial, T crcTable[256], uint8_t width = 8*sizeof(T))
+{
+    T remainder = 0;
+
+    T reflectedPolynomial = (T)CrcReflectValue(polynomial, width);
+    uint32_t ui32Dividend = 0;
+
+    for (ui32Dividend = 0; ui32Dividend < 256; ui32Dividend++)
+    {
+        remainder = (T)ui32Dividend;
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if (0 == (remainder & 0x01))
+            {
+                remainder >>= 1;
+            }
+            else
+            {
+                remainder = (remainder >> 1) ^ reflectedPolynomial;
+            }
+        }
+
+        crcTable[ui32Dividend] = remainder;
+    }
+}
+
+// Extended lookup tables for slicing-by-N. crcTable[0] is the plain 256 entry table,
+// crcTable[k][d] is the CRC of byte d followed by k zero bytes.
+template <class T>
+void CrcSlicingTableGenerator(T polynomial, T crcTable[][256], uint8_t nSlices, uint8_t width = 8*sizeof(T))
+{
+    uint32_t ui32Dividend;
+
+    CrcTableGenerator<T>(polynomial, crcTable[0], width);
+
+    for (uint8_t slice = 1; slice < nSlices; slice++)
+    {
+        for (ui32Dividend = 0; ui32Dividend < 256; ui32Dividend++)
+        {
+            T previous = crcTable[slice - 1][ui32Dividend];
+            crcTable[slice][ui32Dividend] = (T)(previous << 8) ^ crcTable[0][(uint8_t)(previous >> (8*sizeof(T) - 8))];
+        }
+    }
+}
+
+// Reflected companion of CrcSlicingTableGenerator(). crcTable[0] is the CrcReflectedTableGenerator() table,
+// crcTable[k][d] is the reflected CRC of byte d followed by k zero bytes.
+template <class T>
+void CrcReflectedSlicingTableGenerator(T polynomial, T crcTable[][256], uint8_t nSlices, uint8_t width = 8*sizeof(T))
+{
+    uint32_t ui32Dividend;
+
+    CrcReflectedTableGenerator<T>(polynomial, crcTable[0], width);
+
+    for (uint8_t slice = 1; slice < nSlices; slice++)
+    {
+        for (ui32Dividend = 0; ui32Dividend < 256; ui32Dividend++)
+        {
+            T previous = crcTable[slice - 1][ui32Dividend];
+            crcTable[slice][ui32Dividend] = (T)(previous >> 8) ^ crcTable[0][(uint8_t)previous];
+        }
+    }
+}
+
+template <class T>
+struct CrcNibbleTable
+{
+    T entry[16];
+};
+
+// 16 entry lookup table, one lookup per 4 bits of data. Table is 16 times smaller than CrcTableGenerator() table
+// (64 bytes for CRC32), for targets where several 1 KB tables would not fit into the data cache together.
+template <class T>
+constexpr void CrcNibbleTableGenerator(T polynomial, T crcTable[16], uint8_t width = 8*sizeof(T))
+{
+    T topBit = (T)(0x01ULL << (8*sizeof(T) - 1));
+
+    polynomial = CrcAlignLeft<T>(polynomial, width);
+
+    for (uint32_t ui32Dividend = 0; ui32Dividend < 16; ui32Dividend++)
+    {
+        T remainder = (T)((uint64_t)ui32Dividend << (8*sizeof(T) - 4));
+
+        for (uint8_t bit = 0; bit < 4; bit++)
+        {
+            if (0 == (remainder & topBit))
+            {
+                remainder = (T)(remainder << 1);
+            }
+            else
+            {
+                remainder = (T)(remainder << 1) ^ polynomial;
+            }
+        }
+
+        crcTable[ui32Dividend] = remainder;
+    }
+}
+
+// 16 entry lookup table for reflected (LSB first) algorithm, polynomial is given in the normal MSB first form.
+template <class T>
+constexpr void CrcReflectedNibbleTableGenerator(T polynomial, T crcTable[16], uint8_t width = 8*sizeof(T))
+{
+    T reflectedPolynomial = (T)CrcReflectValue(polynomial, width);
+
+    for (uint32_t ui32Dividend = 0; ui32Dividend < 16; ui32Dividend++)
+    {
+        T remainder = (T)ui32Dividend;
+
+        for (uint8_t bit = 0; bit < 4; bit++)
+        {
+            if (0 == (remainder & 0x01))
+            {
+                remainder >>= 1;
+            }
+            else
+            {
+                remainder = (T)(remainder >> 1) ^ reflectedPolynomial;
+            }
+        }
+
+        crcTable[ui32Dividend] = remainder;
+    }
+}
+
+// Kernel for normal (MSB first) register and table from CrcTableGenerator().
+// crc_InitialValue is the register value before the first byte, crc_XorValue is applied before output reflection.
+template <class T, bool RefIn, bool RefOut, bool FinalXor>
+struct CrcKernel
+{
+    static constexpr T Step(const T crcTable[256], uint8_t data, T crc)
+    {
+        uint8_t temp = RefIn ? crcByteReflection.entry[data] : data;
+
+        if constexpr (1 == sizeof(T)) // CRC8
+        {
+            return crcTable[(uint8_t)(crc ^ temp)];
+        }
+        else // CRC16, CRC32, CRC64
+        {
+            return (T)(crc << 8) ^ crcTable[(uint8_t)((crc >> (8*sizeof(T) - 8)) ^ temp)];
+        }
+    }
+
+    static constexpr T Update(const T crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc)
+    {
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            crc = Step(crcTable, crc_DataPtr[ui32Counter], crc);
+        }
+
+        return crc;
+    }
+
+    static constexpr T Finalize(T crc, T crc_XorValue)
+    {
+        if constexpr (FinalXor)
+        {
+            crc ^= crc_XorValue;
+        }
+        if constexpr (RefOut)
+        {
+            crc = (T)CrcReflectValue(crc, 8*sizeof(T));
+        }
+        return crc;
+    }
+
+    static constexpr T Calculate(const T crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue)
+    {
+        return Finalize(Update(crcTable, crc_DataPtr, crc_Length, crc_InitialValue), crc_XorValue);
+    }
+
+    // Two lookups in the table from CrcNibbleTableGenerator() per byte
+    static constexpr T UpdateNibble(const T crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc)
+    {
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            uint8_t temp = RefIn ? (uint8_t)CrcReflectValue(crc_DataPtr[ui32Counter], 8) : crc_DataPtr[ui32Counter];
+
+            crc ^= (T)((T)temp << (8*sizeof(T) - 8));
+            crc = (T)(crc << 4) ^ crcTable[crc >> (8*sizeof(T) - 4)];
+            crc = (T)(crc << 4) ^ crcTable[crc >> (8*sizeof(T) - 4)];
+        }
+
+        return crc;
+    }
+
+    // No table, one shift per bit
+    static constexpr T UpdateBitwise(T polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc)
+    {
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            uint8_t temp = RefIn ? (uint8_t)CrcReflectValue(crc_DataPtr[ui32Counter], 8) : crc_DataPtr[ui32Counter];
+
+            crc ^= (T)((T)temp << (8*sizeof(T) - 8));
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                // polynomial is xored when the top bit is shifted out, without a branch
+                crc = (T)(crc << 1) ^ (T)(polynomial & (T)(0 - (crc >> (8*sizeof(T) - 1))));
+            }
+        }
+
+        return crc;
+    }
+
+    // Slicing-by-N: N independent table lookups per step instead of one serial lookup per byte.
+    // N must be at least sizeof(T), crcTable from CrcSlicingTableGenerator() with at least N slices.
+    template <uint32_t N>
+    static T CalculateSlicing(const T crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue)
+    {
+        uint8_t block[N];
+        T crc = crc_InitialValue;
+
+        while (crc_Length >= N)
+        {
+            for (uint32_t i = 0U; i < N; i++)
+            {
+                block[i] = RefIn ? crcByteReflection.entry[crc_DataPtr[i]] : crc_DataPtr[i];
+            }
+
+            // current CRC is xored into the first bytes of the block, MSB first
+            for (uint32_t i = 0U; i < sizeof(T); i++)
+            {
+                block[i] ^= (uint8_t)(crc >> (8*(sizeof(T) - 1 - i)));
+            }
+
+            crc = 0;
+            for (uint32_t i = 0U; i < N; i++)
+            {
+                crc ^= crcTable[N - 1 - i][block[i]];
+            }
+
+            crc_DataPtr += N;
+            crc_Length -= N;
+        }
+
+        return Calculate(crcTable[0], crc_DataPtr, crc_Length, crc, crc_XorValue);
+    }
+};
+
+// Kernel for reflected (LSB first) register and table from CrcReflectedTableGenerator(), input is always reflected.
+// crc_InitialValue and crc_XorValue have the same meaning as for CrcKernel, the register is kept reflected.
+template <class T, bool RefOut, bool FinalXor>
+struct CrcReflectedKernel
+{
+    static constexpr T Update(const T crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc)
+    {
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            if constexpr (1 == sizeof(T)) // CRC8
+            {
+                crc = crcTable[(uint8_t)(crc ^ crc_DataPtr[ui32Counter])];
+            }
+            else // CRC16, CRC32, CRC64
+            {
+                crc = (T)(crc >> 8) ^ crcTable[(uint8_t)(crc ^ crc_DataPtr[ui32Counter])];
+            }
+        }
+
+        return crc;
+    }
+
+    static constexpr T Finalize(T crc, T crc_XorValue)
+    {
+        if constexpr (RefOut)
+        {
+            if constexpr (FinalXor)
+            {
+                crc ^= (T)CrcReflectValue(crc_XorValue, 8*sizeof(T));
+            }
+        }
+        else
+        {
+            crc = (T)CrcReflectValue(crc, 8*sizeof(T));
+            if constexpr (FinalXor)
+            {
+                crc ^= crc_XorValue;
+            }
+        }
+        return crc;
+    }
+
+    static constexpr T Calculate(const T crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue)
+    {
+        T crc = (T)CrcReflectValue(crc_InitialValue, 8*sizeof(T));
+        return Finalize(Update(crcTable, crc_DataPtr, crc_Length, crc), crc_XorValue);
+    }
+
+    // Slicing-by-N with the register shifted right, no input byte is reflected. N must be at least sizeof(T),
+    // crcTable from CrcReflectedSlicingTableGenerator() with at least N slices.
+    template <uint32_t N>
+    static T CalculateSlicing(const T crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue)
+    {
+        uint8_t block[N];
+        T crc = (T)CrcReflectValue(crc_InitialValue, 8*sizeof(T));
+
+        while (crc_Length >= N)
+        {
+            for (uint32_t i = 0U; i < N; i++)
+            {
+                block[i] = crc_DataPtr[i];
+            }
+
+            // current CRC is xored into the first bytes of the block, LSB first
+            for (uint32_t i = 0U; i < sizeof(T); i++)
+            {
+                block[i] ^= (uint8_t)(crc >> (8*i));
+            }
+
+            crc = 0;
+            for (uint32_t i = 0U; i < N; i++)
+            {
+                crc ^= crcTable[N - 1 - i][block[i]];
+            }
+
+            crc_DataPtr += N;
+            crc_Length -= N;
+        }
+
+        return Finalize(Update(crcTable[0], crc_DataPtr, crc_Length, crc), crc_XorValue);
+    }
+
+    // Two lookups in the table from CrcReflectedNibbleTableGenerator() per byte
+    static constexpr T UpdateNibble(const T crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc)
+    {
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            crc ^= crc_DataPtr[ui32Counter];
+            crc = (T)(crc >> 4) ^ crcTable[crc & 0x0F];
+            crc = (T)(crc >> 4) ^ crcTable[crc & 0x0F];
+        }
+
+        return crc;
+    }
+
+    // No table, polynomial is given in the normal MSB first form
+    static constexpr T UpdateBitwise(T polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc)
+    {
+        T reflectedPolynomial = (T)CrcReflectValue(polynomial, 8*sizeof(T));
+
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            crc ^= crc_DataPtr[ui32Counter];
+            for (uint8_t bit = 0; bit < 8; bit++)
+            {
+                crc = (T)(crc >> 1) ^ (T)(reflectedPolynomial & (T)(0 - (crc & 0x01)));
+            }
+        }
+
+        return crc;
+    }
+};
+
+// Calls call(kernel) with the CrcKernel instance matching the runtime flags, flags are checked once per call
+template <class T, class Call>
+T CrcKernelDispatch(bool reflectedOutput, bool reflectedInput, T crc_XorValue, Call call)
+{
+    bool finalXor = (0 != crc_XorValue);
+
+    if (reflectedInput)
+    {
+        if (reflectedOutput)
+        {
+            return finalXor ? call(CrcKernel<T, true, true, true>()) : call(CrcKernel<T, true, true, false>());
+        }
+        return finalXor ? call(CrcKernel<T, true, false, true>()) : call(CrcKernel<T, true, false, false>());
+    }
+    if (reflectedOutput)
+    {
+        return finalXor ? call(CrcKernel<T, false, true, true>()) : call(CrcKernel<T, false, true, false>());
+    }
+    return finalXor ? call(CrcKernel<T, false, false, true>()) : call(CrcKernel<T, false, false, false>());
+}
+
+// crcTable from CrcTableGenerator() with the same width
+template <class T>
+T CalculateCRC(const T crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput,
+               uint8_t width = 8*sizeof(T))
+{
+    T crc = CrcKernelDispatch<T>(reflectedOutput, reflectedInput, crc_XorValue, [&](auto kernel)
+    {
+        return decltype(kernel)::Calculate(crcTable, crc_DataPtr, crc_Length, CrcAlignLeft<T>(crc_InitialValue, width), CrcAlignLeft<T>(crc_XorValue, width));
+    });
+
+    return CrcAlignRight<T>(crc, width, reflectedOutput);
+}
+
+// CRC of crc_LengthBits bits, the last byte may be used only partly. Bits of a byte are taken MSB first, with
+// reflected input LSB first, so the used bits of the last byte are its high bits (low bits with reflected input).
+// crcTable from CrcTableGenerator() with the same width, other parameters have the same meaning as for CalculateCRC().
+template <class T>
+T CalculateCRCBits(const T crcTable[256], const uint8_t *crc_DataPtr, uint64_t crc_LengthBits, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput,
+                   uint8_t width = 8*sizeof(T))
+{
+    uint32_t crc_Length = (uint32_t)(crc_LengthBits / 8);
+    uint8_t tailBits = (uint8_t)(crc_LengthBits % 8);
+
+    // left aligned register without xor and output reflection
+    T crc = CrcKernelDispatch<T>(false, reflectedInput, 0, [&](auto kernel)
+    {
+        return decltype(kernel)::Update(crcTable, crc_DataPtr, crc_Length, CrcAlignLeft<T>(crc_InitialValue, width));
+    });
+
+    if (0 != tailBits)
+    {
+        // CRC of byte 0x01 is the left aligned polynomial
+        T polynomial = crcTable[1];
+        uint8_t tail = reflectedInput ? crcByteReflection.entry[crc_DataPtr[crc_Length]] : crc_DataPtr[crc_Length];
+
+        crc ^= (T)((uint64_t)(tail & (uint8_t)(0xFF00U >> tailBits)) << (8*sizeof(T) - 8));
+        for (uint8_t bit = 0; bit < tailBits; bit++)
+        {
+            crc = (T)(crc << 1) ^ (T)(polynomial & (T)(0 - (crc >> (8*sizeof(T) - 1))));
+        }
+    }
+
+    crc ^= CrcAlignLeft<T>(crc_XorValue, width);
+    if (reflectedOutput)
+    {
+        crc = (T)CrcReflectValue(crc, 8*sizeof(T));
+    }
+
+    return CrcAlignRight<T>(crc, width, reflectedOutput);
+}
+
+// Reflected input CRC with table from CrcReflectedTableGenerator(). CRC register is kept reflected and shifted right,
+// crc_InitialValue, crc_XorValue and reflectedOutput have the same meaning as for CalculateCRC() with reflectedInput = true.
+template <class T>
+T CalculateCRCReflected(const T crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput,
+                        uint8_t width = 8*sizeof(T))
+{
+    bool finalXor = (0 != crc_XorValue);
+
+    crc_InitialValue = CrcAlignLeft<T>(crc_InitialValue, width);
+    crc_XorValue = CrcAlignLeft<T>(crc_XorValue, width);
+
+    if (reflectedOutput)
+    {
+        return finalXor ? CrcReflectedKernel<T, true, true>::Calculate(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue)
+                        : CrcReflectedKernel<T, true, false>::Calculate(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue);
+    }
+    T crc = finalXor ? CrcReflectedKernel<T, false, true>::Calculate(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue)
+                     : CrcReflectedKernel<T, false, false>::Calculate(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue);
+    return CrcAlignRight<T>(crc, width, false);
+}
+
+// Slicing-by-N with table from CrcSlicingTableGenerator(), intended for CRC16 and CRC32 with N = 8 or N = 16.
+// Reflected input models are faster with CalculateCRCReflectedSlicing(), here every input byte is reflected.
+template <class T, uint32_t N>
+T CalculateCRCSlicing(const T crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput,
+                      uint8_t width = 8*sizeof(T))
+{
+    T crc = CrcKernelDispatch<T>(reflectedOutput, reflectedInput, crc_XorValue, [&](auto kernel)
+    {
+        return decltype(kernel)::template CalculateSlicing<N>(crcTable, crc_DataPtr, crc_Length, CrcAlignLeft<T>(crc_InitialValue, width), CrcAlignLeft<T>(crc_XorValue, width));
+    });
+
+    return CrcAlignRight<T>(crc, width, reflectedOutput);
+}
+
+// Reflected input slicing-by-N with table from CrcReflectedSlicingTableGenerator(), same cost per byte as
+// CalculateCRCSlicing() of a normal model. Parameters have the same meaning as for CalculateCRCReflected().
+template <class T, uint32_t N>
+T CalculateCRCReflectedSlicing(const T crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput,
+                               uint8_t width = 8*sizeof(T))
+{
+    bool finalXor = (0 != crc_XorValue);
+
+    crc_InitialValue = CrcAlignLeft<T>(crc_InitialValue, width);
+    crc_XorValue = CrcAlignLeft<T>(crc_XorValue, width);
+
+    if (reflectedOutput)
+    {
+        return finalXor ? CrcReflectedKernel<T, true, true>::template CalculateSlicing<N>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue)
+                        : CrcReflectedKernel<T, true, false>::template CalculateSlicing<N>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue);
+    }
+    T crc = finalXor ? CrcReflectedKernel<T, false, true>::template CalculateSlicing<N>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue)
+                     : CrcReflectedKernel<T, false, false>::template CalculateSlicing<N>(crcTable, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue);
+    return CrcAlignRight<T>(crc, width, false);
+}
+
+// Nibble table from CrcNibbleTableGenerator(), parameters have the same meaning as for CalculateCRC()
+template <class T>
+T CalculateCRCNibble(const T crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput,
+                     uint8_t width = 8*sizeof(T))
+{
+    T crc = CrcKernelDispatch<T>(reflectedOutput, reflectedInput, crc_XorValue, [&](auto kernel)
+    {
+        typedef decltype(kernel) Kernel;
+        return Kernel::Finalize(Kernel::UpdateNibble(crcTable, crc_DataPtr, crc_Length, CrcAlignLeft<T>(crc_InitialValue, width)), CrcAlignLeft<T>(crc_XorValue, width));
+    });
+
+    return CrcAlignRight<T>(crc, width, reflectedOutput);
+}
+
+// Without lookup table, parameters have the same meaning as for CalculateCRC()
+template <class T>
+T CalculateCRCBitwise(T polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput,
+                      uint8_t width = 8*sizeof(T))
+{
+    T crc = CrcKernelDispatch<T>(reflectedOutput, reflectedInput, crc_XorValue, [&](auto kernel)
+    {
+        typedef decltype(kernel) Kernel;
+        return Kernel::Finalize(Kernel::UpdateBitwise(CrcAlignLeft<T>(polynomial, width), crc_DataPtr, crc_Length, CrcAlignLeft<T>(crc_InitialValue, width)),
+                                CrcAlignLeft<T>(crc_XorValue, width));
+    });
+
+    return CrcAlignRight<T>(crc, width, reflectedOutput);
+}
+
+#endif /* CRC_KERNEL_H */
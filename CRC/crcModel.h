@@ -0,0 +1,208 @@
+#ifndef CRC_MODEL_H
+#define CRC_MODEL_H
+
+#include <stdint.h>
+#include <type_traits>
+
+#include "crcKernel.h"
+#include "crcCombine.h"
+
+//Compile time CRC models. Lookup table of every model is generated by the compiler and placed in read only data,
+//there is no table generator call at startup and no table argument. Reflection and xor flags are template
+//parameters, so the matching kernel from crcKernel.h is selected at compile time.
+//
+//Example:
+//    uint8_t crc = Crc8SaeJ1850::Calculate(message, sizeof(message));
+//
+//Table size is selected per model with CrcTableMode, e.g. Crc32Ethernet::WithTableMode<CRC_TABLE_NIBBLE> uses a
+//64 byte table instead of 1 KB. Tables which are not used by the selected mode are not placed in the binary.
+
+template <uint8_t Width> struct CrcRegister;
+template <> struct CrcRegister<8>  { typedef uint8_t  type; };
+template <> struct CrcRegister<16> { typedef uint16_t type; };
+template <> struct CrcRegister<32> { typedef uint32_t type; };
+template <> struct CrcRegister<64> { typedef uint64_t type; };
+
+// Memory size tiers of a model, from fastest to smallest
+enum CrcTableMode
+{
+    CRC_TABLE_BYTE,     // 256 entries, one lookup per byte
+    CRC_TABLE_NIBBLE,   // 16 entries, two lookups per byte
+    CRC_TABLE_BITWISE   // no table, eight shifts per byte
+};
+
+// Same tables as CrcTableGenerator() for normal models and CrcReflectedTableGenerator() for reflected input models
+template <class T>
+constexpr CrcTable<T> CrcConstexprTableGenerator(T polynomial, bool reflectedInput)
+{
+    CrcTable<T> crcTable = {};
+
+    if (reflectedInput)
+    {
+        CrcReflectedTableGenerator<T>(polynomial, crcTable.entry);
+    }
+    else
+    {
+        CrcTableGenerator<T>(polynomial, crcTable.entry);
+    }
+
+    return crcTable;
+}
+
+// Same tables as CrcNibbleTableGenerator() for normal models and CrcReflectedNibbleTableGenerator() for reflected input models
+template <class T>
+constexpr CrcNibbleTable<T> CrcConstexprNibbleTableGenerator(T polynomial, bool reflectedInput)
+{
+    CrcNibbleTable<T> crcTable = {};
+
+    if (reflectedInput)
+    {
+        CrcReflectedNibbleTableGenerator<T>(polynomial, crcTable.entry);
+    }
+    else
+    {
+        CrcNibbleTableGenerator<T>(polynomial, crcTable.entry);
+    }
+
+    return crcTable;
+}
+
+// Init and XorOut have the same meaning as crc_InitialValue and crc_XorValue of CalculateCRC()
+template <uint8_t Width, uint64_t Poly, uint64_t Init, uint64_t XorOut, bool RefIn, bool RefOut, CrcTableMode Mode = CRC_TABLE_BYTE>
+struct CrcModel
+{
+    typedef typename CrcRegister<Width>::type T;
+
+    static constexpr uint8_t width = Width;
+    static constexpr T polynomial = (T)Poly;
+    static constexpr T initialValue = (T)Init;
+    static constexpr T xorValue = (T)XorOut;
+    static constexpr bool reflectedInput = RefIn;
+    static constexpr bool reflectedOutput = RefOut;
+    static constexpr CrcTableMode tableMode = Mode;
+
+    static constexpr CrcTable<T> table = CrcConstexprTableGenerator<T>((T)Poly, RefIn);
+    static constexpr CrcNibbleTable<T> nibbleTable = CrcConstexprNibbleTableGenerator<T>((T)Poly, RefIn);
+
+    // Bytes of lookup table used by the selected mode
+    static constexpr uint32_t tableSize = (CRC_TABLE_BYTE == Mode) ? sizeof(table) : ((CRC_TABLE_NIBBLE == Mode) ? sizeof(nibbleTable) : 0);
+
+    // Same model with other table size
+    template <CrcTableMode NewMode>
+    using WithTableMode = CrcModel<Width, Poly, Init, XorOut, RefIn, RefOut, NewMode>;
+
+    // reflected models keep the register reflected and shift right
+    typedef typename std::conditional<RefIn, CrcReflectedKernel<T, RefOut, 0 != XorOut>, CrcKernel<T, false, RefOut, 0 != XorOut> >::type Kernel;
+
+    // Register value before the first byte
+    static constexpr T Start()
+    {
+        return RefIn ? (T)CrcReflectValue(Init, Width) : (T)Init;
+    }
+
+    // Register value to continue with after Finalize() returned crc_PreviousResult (AUTOSAR Crc_StartValue)
+    static constexpr T Restart(T crc_PreviousResult)
+    {
+        T crc = (RefIn != RefOut) ? (T)CrcReflectValue(crc_PreviousResult, Width) : crc_PreviousResult;
+        return crc ^ (RefIn ? (T)CrcReflectValue(XorOut, Width) : (T)XorOut);
+    }
+
+    static constexpr T Update(T crc, const uint8_t *crc_DataPtr, uint32_t crc_Length)
+    {
+        if constexpr (CRC_TABLE_BYTE == Mode)
+        {
+            return Kernel::Update(table.entry, crc_DataPtr, crc_Length, crc);
+        }
+        else if constexpr (CRC_TABLE_NIBBLE == Mode)
+        {
+            return Kernel::UpdateNibble(nibbleTable.entry, crc_DataPtr, crc_Length, crc);
+        }
+        else
+        {
+            return Kernel::UpdateBitwise((T)Poly, crc_DataPtr, crc_Length, crc);
+        }
+    }
+
+    static constexpr T Finalize(T crc)
+    {
+        return Kernel::Finalize(crc, (T)XorOut);
+    }
+
+    static constexpr T Calculate(const uint8_t *crc_DataPtr, uint32_t crc_Length)
+    {
+        return Finalize(Update(Start(), crc_DataPtr, crc_Length));
+    }
+
+    // CRC of A followed by B, see crcCombine.h
+    static constexpr T Combine(T crcA, T crcB, uint64_t lengthB)
+    {
+        return CrcCombine<T>(crcA, crcB, lengthB, (T)Poly, (T)Init, (T)XorOut, RefOut, Width);
+    }
+
+    // CRC after crc_Length bytes at crcOffset changed from oldData to newData, see CrcUpdateInPlace()
+    static constexpr T UpdateInPlace(T crc, uint64_t totalLength, uint64_t crcOffset, const uint8_t *oldData, const uint8_t *newData, uint32_t crc_Length)
+    {
+        T delta = 0;
+
+        for (uint32_t ui32Counter = 0U; ui32Counter < crc_Length; ui32Counter++)
+        {
+            uint8_t data = oldData[ui32Counter] ^ newData[ui32Counter];
+            delta = Update(delta, &data, 1);
+        }
+
+        // reflected models keep the register reflected, CrcShift() works on the normal one
+        if constexpr (RefIn)
+        {
+            delta = (T)CrcReflectValue(delta, Width);
+        }
+
+        T crcRegister = CrcUnfinalize<T>(crc, (T)XorOut, RefOut);
+
+        return CrcFinalize<T>(crcRegister ^ CrcShift<T>(delta, totalLength - crcOffset - crc_Length, (T)Poly, Width), (T)XorOut, RefOut);
+    }
+};
+
+// Streaming state, data can be given in any number of Update() calls.
+//
+// Example:
+//    CrcContext<Crc32Ethernet> context;
+//    context.Init();
+//    context.Update(header, sizeof(header));
+//    context.Update(payload, payloadLength);
+//    uint32_t crc = context.Finalize();
+template <class Model>
+struct CrcContext
+{
+    typename Model::T crc;
+
+    void Init()
+    {
+        crc = Model::Start();
+    }
+
+    // continue a CRC which was already finalized, crc_StartValue is the previous result
+    void Init(typename Model::T crc_StartValue)
+    {
+        crc = Model::Restart(crc_StartValue);
+    }
+
+    void Update(const uint8_t *crc_DataPtr, uint32_t crc_Length)
+    {
+        crc = Model::Update(crc, crc_DataPtr, crc_Length);
+    }
+
+    typename Model::T Finalize() const
+    {
+        return Model::Finalize(crc);
+    }
+};
+
+//AUTOSAR Specification of CRC Routines
+typedef CrcModel<8,  0x1D,       0xFF,       0xFF,       false, false> Crc8SaeJ1850;
+typedef CrcModel<8,  0x2F,       0xFF,       0xFF,       false, false> Crc8H2F;
+typedef CrcModel<16, 0x1021,     0xFFFF,     0x0000,     false, false> Crc16CcittFalse;
+typedef CrcModel<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true,  true>  Crc32Ethernet;
+typedef CrcModel<32, 0xF4ACFB13, 0xFFFFFFFF, 0xFFFFFFFF, true,  true>  Crc32P4;
+typedef CrcModel<64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true, true> Crc64Ecma;
+
+#endif /* CRC_MODEL_H */
@@ -0,0 +1,122 @@
+#include <stdint.h>
+#include <vector>
+
+#include "crcCombine.h"
+#include "crcStats.h"
+#include "crcThreadPool.h"
+
+//Parallel CRC for large buffers. Buffer is split into one chunk per thread, every chunk is calculated with the
+//fastest available kernel (carry-less multiply or table) and chunk CRCs are merged with CrcCombine().
+
+// Buffers shorter than this are calculated in the calling thread only
+#define CRC_PARALLEL_MIN_CHUNK  (256U * 1024U)
+
+// Chunk length is limited by crc_Length of the single thread kernels
+#define CRC_PARALLEL_MAX_CHUNK  (1024U * 1024U * 1024U)
+
+extern uint8_t CalculateCRC8Clmul(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Clmul(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Clmul(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+
+template <class T>
+static T CalculateCRCClmul(T crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, T crc_InitialValue, bool reflectedInput)
+{
+    if constexpr (1 == sizeof(T))
+    {
+        return CalculateCRC8Clmul(crcTable, clmulConstants, crc_DataPtr, crc_Length, crc_InitialValue, 0, false, reflectedInput);
+    }
+    else if constexpr (2 == sizeof(T))
+    {
+        return CalculateCRC16Clmul(crcTable, clmulConstants, crc_DataPtr, crc_Length, crc_InitialValue, 0, false, reflectedInput);
+    }
+    else
+    {
+        return CalculateCRC32Clmul(crcTable, clmulConstants, crc_DataPtr, crc_Length, crc_InitialValue, 0, false, reflectedInput);
+    }
+}
+
+template <class T>
+static T CalculateCRCParallel(T crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CrcThreadPool &pool = CrcThreadPool::Shared();
+    // normal table entry 1 is CRC of byte 0x01 without init, which is the polynomial itself
+    T polynomial = crcTable[1];
+    uint64_t nChunks = pool.Workers() + 1U;
+
+    if (crc_Length / nChunks < CRC_PARALLEL_MIN_CHUNK)
+    {
+        nChunks = crc_Length / CRC_PARALLEL_MIN_CHUNK;
+    }
+    if (crc_Length / CRC_PARALLEL_MAX_CHUNK >= nChunks)
+    {
+        nChunks = crc_Length / CRC_PARALLEL_MAX_CHUNK + 1U;
+    }
+    if (nChunks <= 1U)
+    {
+        nChunks = 1U;
+    }
+
+    // chunk registers without final xor and reflection, each started from crc_InitialValue
+    std::vector<T> chunkCrc(nChunks);
+    std::vector<uint64_t> chunkLength(nChunks);
+    uint64_t chunkSize = crc_Length / nChunks;
+
+    {
+        CrcTaskGroup group(pool);
+
+        for (uint64_t i = 0; i < nChunks; i++)
+        {
+            const uint8_t *chunkPtr = crc_DataPtr + i * chunkSize;
+            chunkLength[i] = (i == nChunks - 1U) ? (crc_Length - i * chunkSize) : chunkSize;
+
+            if (i == nChunks - 1U)
+            {
+                // last chunk is calculated by the caller while workers run the others
+                chunkCrc[i] = CalculateCRCClmul<T>(crcTable, clmulConstants, chunkPtr, (uint32_t)chunkLength[i], crc_InitialValue, reflectedInput);
+            }
+            else
+            {
+                T *result = &chunkCrc[i];
+                uint32_t length = (uint32_t)chunkLength[i];
+                group.Run([=]()
+                {
+                    *result = CalculateCRCClmul<T>(crcTable, clmulConstants, chunkPtr, length, crc_InitialValue, reflectedInput);
+                });
+            }
+        }
+
+        group.Wait();
+    }
+
+    T crc = chunkCrc[0];
+    for (uint64_t i = 1; i < nChunks; i++)
+    {
+        crc = CrcCombine<T>(crc, chunkCrc[i], chunkLength[i], polynomial, crc_InitialValue, 0, false);
+    }
+
+    return CrcFinalize<T>(crc, crc_XorValue, reflectedOutput);
+}
+
+// crcTable from Crc8TableGenerator(), clmulConstants from CrcClmulConstantsGenerator() with the same polynomial
+uint8_t CalculateCRC8Parallel(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_PARALLEL, crc_Length);
+
+    return CalculateCRCParallel<uint8_t>(crcTable, clmulConstants, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable from Crc16TableGenerator(), clmulConstants from CrcClmulConstantsGenerator() with the same polynomial
+uint16_t CalculateCRC16Parallel(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_PARALLEL, crc_Length);
+
+    return CalculateCRCParallel<uint16_t>(crcTable, clmulConstants, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable from Crc32TableGenerator(), clmulConstants from CrcClmulConstantsGenerator() with the same polynomial
+uint32_t CalculateCRC32Parallel(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_PARALLEL, crc_Length);
+
+    return CalculateCRCParallel<uint32_t>(crcTable, clmulConstants, crc_DataPtr, crc_Length, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
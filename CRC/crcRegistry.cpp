@@ -0,0 +1,262 @@
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include "crcCombine.h"
+#include "crcKernel.h"
+#include "crcRegistry.h"
+#include "crcStats.h"
+
+extern void Crc8TableGenerator(uint8_t polynomial, uint8_t crcTable[256]);
+extern void Crc16TableGenerator(uint16_t polynomial, uint16_t crcTable[256]);
+extern void Crc32TableGenerator(uint32_t polynomial, uint32_t crcTable[256]);
+extern void Crc64TableGenerator(uint64_t polynomial, uint64_t crcTable[256]);
+extern bool CrcClmulAvailable();
+extern void CrcClmulConstantsGenerator(uint64_t polynomial, uint8_t width, uint64_t clmulConstants[16]);
+extern uint8_t CalculateCRC8Clmul(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Clmul(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Clmul(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Clmul(uint64_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+
+#define CRC_F8      0xFFULL
+#define CRC_F16     0xFFFFULL
+#define CRC_F32     0xFFFFFFFFULL
+#define CRC_F64     0xFFFFFFFFFFFFFFFFULL
+
+// Shorter data is not folded by CalculateCRCxxClmul(), same as CRC_CLMUL_MIN_LENGTH in crcClmul.cpp
+#define CRC_REGISTRY_CLMUL_LENGTH   128U
+
+// Same order as CrcModelId
+static const CrcModelParameters crcModelCatalogue[CRC_MODEL_COUNT] =
+{
+    { "CRC-8/SAE-J1850",  "CRC8",    8,  0x1D,               CRC_F8,  CRC_F8,  false, false, 0x4B },
+    { "CRC-8/AUTOSAR",    "CRC8H2F", 8,  0x2F,               CRC_F8,  CRC_F8,  false, false, 0xDF },
+    { "CRC-16/IBM-3740",  "CRC16",   16, 0x1021,             CRC_F16, 0,       false, false, 0x29B1 },
+    { "CRC-32/ISO-HDLC",  "CRC32",   32, 0x04C11DB7,         CRC_F32, CRC_F32, true,  true,  0xCBF43926 },
+    { "CRC-32/AUTOSAR",   "CRC32P4", 32, 0xF4ACFB13,         CRC_F32, CRC_F32, true,  true,  0x1697D06A },
+    { "CRC-64/XZ",        "CRC64",   64, 0x42F0E1EBA9EA3693, CRC_F64, CRC_F64, true,  true,  0x995DC9BBDF1939FA },
+
+    { "CRC-8/SMBUS",      nullptr,   8,  0x07,               0,       0,       false, false, 0xF4 },
+    { "CRC-8/MAXIM-DOW",  nullptr,   8,  0x31,               0,       0,       true,  true,  0xA1 },
+    { "CRC-8/ROHC",       nullptr,   8,  0x07,               CRC_F8,  0,       true,  true,  0xD0 },
+    { "CRC-8/CDMA2000",   nullptr,   8,  0x9B,               CRC_F8,  0,       false, false, 0xDA },
+    { "CRC-8/BLUETOOTH",  nullptr,   8,  0xA7,               0,       0,       true,  true,  0x26 },
+    { "CRC-16/ARC",       nullptr,   16, 0x8005,             0,       0,       true,  true,  0xBB3D },
+    { "CRC-16/MODBUS",    nullptr,   16, 0x8005,             CRC_F16, 0,       true,  true,  0x4B37 },
+    { "CRC-16/KERMIT",    nullptr,   16, 0x1021,             0,       0,       true,  true,  0x2189 },
+    { "CRC-16/XMODEM",    nullptr,   16, 0x1021,             0,       0,       false, false, 0x31C3 },
+    { "CRC-16/IBM-SDLC",  nullptr,   16, 0x1021,             CRC_F16, CRC_F16, true,  true,  0x906E },
+    { "CRC-16/USB",       nullptr,   16, 0x8005,             CRC_F16, CRC_F16, true,  true,  0xB4C8 },
+    { "CRC-16/GENIBUS",   nullptr,   16, 0x1021,             CRC_F16, CRC_F16, false, false, 0xD64E },
+    { "CRC-16/MCRF4XX",   nullptr,   16, 0x1021,             CRC_F16, 0,       true,  true,  0x6F91 },
+    { "CRC-16/DNP",       nullptr,   16, 0x3D65,             0,       CRC_F16, true,  true,  0xEA82 },
+    { "CRC-32/ISCSI",     nullptr,   32, 0x1EDC6F41,         CRC_F32, CRC_F32, true,  true,  0xE3069283 },
+    { "CRC-32/BZIP2",     nullptr,   32, 0x04C11DB7,         CRC_F32, CRC_F32, false, false, 0xFC891918 },
+    { "CRC-32/MPEG-2",    nullptr,   32, 0x04C11DB7,         CRC_F32, 0,       false, false, 0x0376E6E7 },
+    { "CRC-32/CKSUM",     nullptr,   32, 0x04C11DB7,         0,       CRC_F32, false, false, 0x765E7680 },
+    { "CRC-32/JAMCRC",    nullptr,   32, 0x04C11DB7,         CRC_F32, 0,       true,  true,  0x340BC6D9 },
+    { "CRC-32/XFER",      nullptr,   32, 0x000000AF,         0,       0,       false, false, 0xBD0BE338 },
+    { "CRC-32/BASE91-D",  nullptr,   32, 0xA833982B,         CRC_F32, CRC_F32, true,  true,  0x87315576 },
+    { "CRC-64/ECMA-182",  nullptr,   64, 0x42F0E1EBA9EA3693, 0,       0,       false, false, 0x6C40DF5F0B497347 },
+    { "CRC-64/GO-ISO",    nullptr,   64, 0x000000000000001B, CRC_F64, CRC_F64, true,  true,  0xB90956C775A41001 },
+    { "CRC-64/WE",        nullptr,   64, 0x42F0E1EBA9EA3693, CRC_F64, CRC_F64, false, false, 0x62EC59E3F1A4F00A },
+
+    { "CRC-3/ROHC",       nullptr,   3,  0x3,                0x7,     0,       true,  true,  0x6 },
+    { "CRC-5/USB",        nullptr,   5,  0x05,               0x1F,    0x1F,    true,  true,  0x19 },
+    { "CRC-7/MMC",        nullptr,   7,  0x09,               0,       0,       false, false, 0x75 },
+    { "CRC-11/FLEXRAY",   nullptr,   11, 0x385,              0x01A,   0,       false, false, 0x5A3 },
+    { "CRC-15/CAN",       nullptr,   15, 0x4599,             0,       0,       false, false, 0x059E },
+    { "CRC-17/CAN-FD",    nullptr,   17, 0x1685B,            0,       0,       false, false, 0x04F03 },
+    { "CRC-21/CAN-FD",    nullptr,   21, 0x102899,           0,       0,       false, false, 0x0ED841 },
+    { "CRC-24/FLEXRAY-A", nullptr,   24, 0x5D6DCB,           0xFEDCBA, 0,      false, false, 0x7979BD },
+    { "CRC-24/OPENPGP",   nullptr,   24, 0x864CFB,           0xB704CE, 0,      false, false, 0x21CF02 },
+    { "CRC-31/PHILIPS",   nullptr,   31, 0x04C11DB7,         0x7FFFFFFF, 0x7FFFFFFF, false, false, 0x0CE9E46C },
+    { "CRC-40/GSM",       nullptr,   40, 0x0004820009,       0,       0xFFFFFFFFFF, false, false, 0xD4164FC646 },
+};
+
+// Smallest table width which holds the CRC
+static uint8_t CrcTableWidth(uint8_t width)
+{
+    return (width <= 8) ? 8 : ((width <= 16) ? 16 : ((width <= 32) ? 32 : 64));
+}
+
+// Narrower models are calculated as CRC of the table width with left aligned polynomial and register
+CrcRegisteredModel::CrcRegisteredModel(CrcModelId modelId) : parameters(crcModelCatalogue[modelId]), id(modelId), tableWidth(CrcTableWidth(parameters.width))
+{
+    uint64_t polynomial = parameters.polynomial << (tableWidth - parameters.width);
+
+    switch (tableWidth)
+    {
+        case 8:  Crc8TableGenerator((uint8_t)polynomial, crcTable8bit); break;
+        case 16: Crc16TableGenerator((uint16_t)polynomial, crcTable16bit); break;
+        case 32: Crc32TableGenerator((uint32_t)polynomial, crcTable32bit); break;
+        default: Crc64TableGenerator(polynomial, crcTable64bit); break;
+    }
+    CrcClmulConstantsGenerator(polynomial, tableWidth, clmulConstants);
+
+    // reflected register of the model width is in the low bits, the same for every table width
+    if (parameters.reflectedInput)
+    {
+        switch (tableWidth)
+        {
+            case 8:  CrcReflectedTableGenerator<uint8_t>((uint8_t)parameters.polynomial, crcReflectedTable8bit, parameters.width); break;
+            case 16: CrcReflectedTableGenerator<uint16_t>((uint16_t)parameters.polynomial, crcReflectedTable16bit, parameters.width); break;
+            case 32: CrcReflectedTableGenerator<uint32_t>((uint32_t)parameters.polynomial, crcReflectedTable32bit, parameters.width); break;
+            default: CrcReflectedTableGenerator<uint64_t>(parameters.polynomial, crcReflectedTable64bit, parameters.width); break;
+        }
+    }
+}
+
+uint64_t CrcRegisteredModel::Start() const
+{
+    return parameters.initialValue;
+}
+
+// Tables are only read, the const_cast is for the table argument of the CalculateCRCxx functions
+uint64_t CrcRegisteredModel::Update(uint64_t crc, const uint8_t *crc_DataPtr, uint32_t crc_Length) const
+{
+    if (parameters.reflectedInput && ((crc_Length < CRC_REGISTRY_CLMUL_LENGTH) || !CrcClmulAvailable()))
+    {
+        return UpdateReflected(crc, crc_DataPtr, crc_Length);
+    }
+
+    CRC_STATS_SCOPE((uint32_t)id, CRC_STATS_CLMUL, crc_Length);
+
+    bool reflectedInput = parameters.reflectedInput;
+    uint8_t shift = tableWidth - parameters.width;
+
+    crc <<= shift;
+    switch (tableWidth)
+    {
+        case 8:  crc = CalculateCRC8Clmul(const_cast<uint8_t *>(crcTable8bit), clmulConstants, crc_DataPtr, crc_Length, (uint8_t)crc, 0, false, reflectedInput); break;
+        case 16: crc = CalculateCRC16Clmul(const_cast<uint16_t *>(crcTable16bit), clmulConstants, crc_DataPtr, crc_Length, (uint16_t)crc, 0, false, reflectedInput); break;
+        case 32: crc = CalculateCRC32Clmul(const_cast<uint32_t *>(crcTable32bit), clmulConstants, crc_DataPtr, crc_Length, (uint32_t)crc, 0, false, reflectedInput); break;
+        default: crc = CalculateCRC64Clmul(const_cast<uint64_t *>(crcTable64bit), clmulConstants, crc_DataPtr, crc_Length, crc, 0, false, reflectedInput); break;
+    }
+    return crc >> shift;
+}
+
+// Reflected kernel without per byte reflection, the register is reflected only at the start and the end
+uint64_t CrcRegisteredModel::UpdateReflected(uint64_t crc, const uint8_t *crc_DataPtr, uint32_t crc_Length) const
+{
+    CRC_STATS_SCOPE((uint32_t)id, CRC_STATS_REFLECTED, crc_Length);
+
+    uint8_t width = parameters.width;
+
+    crc = CrcReflectValue(crc, width);
+    switch (tableWidth)
+    {
+        case 8:  crc = CrcReflectedKernel<uint8_t, false, false>::Update(crcReflectedTable8bit, crc_DataPtr, crc_Length, (uint8_t)crc); break;
+        case 16: crc = CrcReflectedKernel<uint16_t, false, false>::Update(crcReflectedTable16bit, crc_DataPtr, crc_Length, (uint16_t)crc); break;
+        case 32: crc = CrcReflectedKernel<uint32_t, false, false>::Update(crcReflectedTable32bit, crc_DataPtr, crc_Length, (uint32_t)crc); break;
+        default: crc = CrcReflectedKernel<uint64_t, false, false>::Update(crcReflectedTable64bit, crc_DataPtr, crc_Length, crc); break;
+    }
+    return CrcReflectValue(crc, width);
+}
+
+uint64_t CrcRegisteredModel::Finalize(uint64_t crc) const
+{
+    uint64_t mask = (64 == parameters.width) ? ~0ULL : ((1ULL << parameters.width) - 1U);
+
+    crc = (crc ^ parameters.xorValue) & mask;
+    if (parameters.reflectedOutput)
+    {
+        crc = CrcReflectValue(crc, parameters.width);
+    }
+    return crc;
+}
+
+uint64_t CrcRegisteredModel::Calculate(const uint8_t *crc_DataPtr, uint32_t crc_Length) const
+{
+    return Finalize(Update(Start(), crc_DataPtr, crc_Length));
+}
+
+uint64_t CrcRegisteredModel::Combine(uint64_t crcA, uint64_t crcB, uint64_t lengthB) const
+{
+    return CrcCombine<uint64_t>(crcA, crcB, lengthB, parameters.polynomial, parameters.initialValue, parameters.xorValue, parameters.reflectedOutput, parameters.width);
+}
+
+const uint8_t *CrcRegisteredModel::Table8() const
+{
+    return (8 == tableWidth) ? crcTable8bit : nullptr;
+}
+
+const uint16_t *CrcRegisteredModel::Table16() const
+{
+    return (16 == tableWidth) ? crcTable16bit : nullptr;
+}
+
+const uint32_t *CrcRegisteredModel::Table32() const
+{
+    return (32 == tableWidth) ? crcTable32bit : nullptr;
+}
+
+const uint64_t *CrcRegisteredModel::Table64() const
+{
+    return (64 == tableWidth) ? crcTable64bit : nullptr;
+}
+
+const uint64_t *CrcRegisteredModel::ClmulConstants() const
+{
+    return clmulConstants;
+}
+
+const CrcModelParameters &CrcGetModelParameters(CrcModelId id)
+{
+    return crcModelCatalogue[id];
+}
+
+// Built models are never freed, so a returned pointer stays valid without reference counting
+static std::atomic<const CrcRegisteredModel *> crcRegisteredModels[CRC_MODEL_COUNT];
+static std::mutex crcRegistryLock;
+
+const CrcRegisteredModel *CrcGetModel(CrcModelId id)
+{
+    if ((uint32_t)id >= CRC_MODEL_COUNT)
+    {
+        return nullptr;
+    }
+
+    // fast path after the first use is one acquire load
+    const CrcRegisteredModel *model = crcRegisteredModels[id].load(std::memory_order_acquire);
+    if (nullptr != model)
+    {
+        return model;
+    }
+
+    std::lock_guard<std::mutex> guard(crcRegistryLock);
+    model = crcRegisteredModels[id].load(std::memory_order_relaxed);
+    if (nullptr == model)
+    {
+        model = new CrcRegisteredModel(id);
+        crcRegisteredModels[id].store(model, std::memory_order_release);
+    }
+    return model;
+}
+
+static std::unordered_map<std::string_view, CrcModelId> CrcModelNamesGenerator()
+{
+    std::unordered_map<std::string_view, CrcModelId> names;
+
+    for (uint32_t id = 0; id < CRC_MODEL_COUNT; id++)
+    {
+        names.emplace(crcModelCatalogue[id].name, (CrcModelId)id);
+        if (nullptr != crcModelCatalogue[id].alias)
+        {
+            names.emplace(crcModelCatalogue[id].alias, (CrcModelId)id);
+        }
+    }
+
+    return names;
+}
+
+const CrcRegisteredModel *CrcFindModel(const char *name)
+{
+    // built once, only read afterwards
+    static const std::unordered_map<std::string_view, CrcModelId> names = CrcModelNamesGenerator();
+
+    auto found = names.find(name);
+    return (names.end() == found) ? nullptr : CrcGetModel(found->second);
+}
@@ -0,0 +1,148 @@
+#ifndef CRC_REGISTRY_H
+#define CRC_REGISTRY_H
+
+#include <stdint.h>
+
+//Catalogue of named CRC models: the AUTOSAR CRC routines and common models of the Rocksoft / reveng catalogue.
+//Lookup table and carry-less multiply constants of a model are generated on the first use and never change,
+//every later lookup returns the same instance without taking a lock, from any thread.
+//
+//Example:
+//    const CrcRegisteredModel *model = CrcFindModel("CRC-32/ISO-HDLC");
+//    uint64_t crc = model->Calculate(message, sizeof(message));
+
+enum CrcModelId
+{
+    // AUTOSAR Specification of CRC Routines
+    CRC_MODEL_CRC8,
+    CRC_MODEL_CRC8H2F,
+    CRC_MODEL_CRC16,
+    CRC_MODEL_CRC32,
+    CRC_MODEL_CRC32P4,
+    CRC_MODEL_CRC64,
+
+    // Rocksoft / reveng catalogue
+    CRC_MODEL_CRC8_SMBUS,
+    CRC_MODEL_CRC8_MAXIM_DOW,
+    CRC_MODEL_CRC8_ROHC,
+    CRC_MODEL_CRC8_CDMA2000,
+    CRC_MODEL_CRC8_BLUETOOTH,
+    CRC_MODEL_CRC16_ARC,
+    CRC_MODEL_CRC16_MODBUS,
+    CRC_MODEL_CRC16_KERMIT,
+    CRC_MODEL_CRC16_XMODEM,
+    CRC_MODEL_CRC16_IBM_SDLC,
+    CRC_MODEL_CRC16_USB,
+    CRC_MODEL_CRC16_GENIBUS,
+    CRC_MODEL_CRC16_MCRF4XX,
+    CRC_MODEL_CRC16_DNP,
+    CRC_MODEL_CRC32_ISCSI,
+    CRC_MODEL_CRC32_BZIP2,
+    CRC_MODEL_CRC32_MPEG2,
+    CRC_MODEL_CRC32_CKSUM,
+    CRC_MODEL_CRC32_JAMCRC,
+    CRC_MODEL_CRC32_XFER,
+    CRC_MODEL_CRC32_BASE91_D,
+    CRC_MODEL_CRC64_ECMA_182,
+    CRC_MODEL_CRC64_GO_ISO,
+    CRC_MODEL_CRC64_WE,
+
+    // widths other than 8, 16, 32 and 64 bits
+    CRC_MODEL_CRC3_ROHC,
+    CRC_MODEL_CRC5_USB,
+    CRC_MODEL_CRC7_MMC,
+    CRC_MODEL_CRC11_FLEXRAY,
+    CRC_MODEL_CRC15_CAN,
+    CRC_MODEL_CRC17_CAN_FD,
+    CRC_MODEL_CRC21_CAN_FD,
+    CRC_MODEL_CRC24_FLEXRAY_A,
+    CRC_MODEL_CRC24_OPENPGP,
+    CRC_MODEL_CRC31_PHILIPS,
+    CRC_MODEL_CRC40_GSM,
+
+    CRC_MODEL_COUNT
+};
+
+// Init and xor have the same meaning as crc_InitialValue and crc_XorValue of CalculateCRC()
+struct CrcModelParameters
+{
+    const char *name;
+    const char *alias;          // AUTOSAR short name or nullptr
+    uint8_t width;              // 3..64 bits
+    uint64_t polynomial;
+    uint64_t initialValue;
+    uint64_t xorValue;
+    bool reflectedInput;
+    bool reflectedOutput;
+    uint64_t check;             // CRC of the ASCII string "123456789"
+};
+
+class CrcRegisteredModel
+{
+public:
+    CrcRegisteredModel(const CrcRegisteredModel &) = delete;
+    CrcRegisteredModel &operator=(const CrcRegisteredModel &) = delete;
+
+    const CrcModelParameters &parameters;
+
+    uint64_t Calculate(const uint8_t *crc_DataPtr, uint32_t crc_Length) const;
+
+    // CRC of A followed by B from the results of Calculate() and the length of B, see crcCombine.h
+    uint64_t Combine(uint64_t crcA, uint64_t crcB, uint64_t lengthB) const;
+
+    // Streaming: register between the calls is kept without xor and output reflection. Long data is folded with
+    // carry-less multiply, reflected input models take the reflected table for the rest.
+    uint64_t Start() const;
+    uint64_t Update(uint64_t crc, const uint8_t *crc_DataPtr, uint32_t crc_Length) const;
+    uint64_t Finalize(uint64_t crc) const;
+
+    // Normal (MSB first) lookup table of the model width, same as Crc8/16/32/64TableGenerator(). Models of other
+    // widths have the table of the next larger of these widths with left aligned entries (CrcTableGenerator() with
+    // width argument), e.g. Table16() for CRC-15/CAN.
+    const uint8_t *Table8() const;
+    const uint16_t *Table16() const;
+    const uint32_t *Table32() const;
+    const uint64_t *Table64() const;
+
+    // Constants of the left aligned polynomial for the table width
+    const uint64_t *ClmulConstants() const;
+
+private:
+    // Only built by CrcGetModel(), one instance per catalogue entry
+    explicit CrcRegisteredModel(CrcModelId modelId);
+    friend const CrcRegisteredModel *CrcGetModel(CrcModelId id);
+
+    uint64_t UpdateReflected(uint64_t crc, const uint8_t *crc_DataPtr, uint32_t crc_Length) const;
+
+    CrcModelId id;
+    uint8_t tableWidth;         // 8, 16, 32 or 64
+
+    union
+    {
+        uint8_t crcTable8bit[256];
+        uint16_t crcTable16bit[256];
+        uint32_t crcTable32bit[256];
+        uint64_t crcTable64bit[256];
+    };
+
+    // CrcReflectedTableGenerator() with the model width, only for reflected input models
+    union
+    {
+        uint8_t crcReflectedTable8bit[256];
+        uint16_t crcReflectedTable16bit[256];
+        uint32_t crcReflectedTable32bit[256];
+        uint64_t crcReflectedTable64bit[256];
+    };
+    uint64_t clmulConstants[16];
+};
+
+// Parameters only, no table is generated
+const CrcModelParameters &CrcGetModelParameters(CrcModelId id);
+
+// Model with generated table, built on the first call for this id
+const CrcRegisteredModel *CrcGetModel(CrcModelId id);
+
+// Lookup by catalogue name or AUTOSAR alias (e.g. "CRC-32/ISO-HDLC" or "CRC32"), nullptr for an unknown name
+const CrcRegisteredModel *CrcFindModel(const char *name);
+
+#endif /* CRC_REGISTRY_H */
@@ -0,0 +1,84 @@
+#include <stdint.h>
+
+#include "crcKernel.h"
+#include "crcStats.h"
+
+//CRC of a message given as an array of segments, e.g. ring buffer fragments or separate header and payload.
+//The register is carried from segment to segment, init is applied before the first segment and xor and output
+//reflection after the last one, so no segment has to be copied into a contiguous buffer.
+
+// Segments of at least this length are given to the carry-less multiply kernel, shorter ones go byte by byte
+#define CRC_SEGMENTS_CLMUL_LENGTH   128U
+
+extern uint8_t CalculateCRC8Clmul(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Clmul(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Clmul(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+
+// Register after the segment, no xor and no output reflection
+template <class T>
+static T CrcSegmentClmul(T crcTable[256], const uint64_t clmulConstants[16], const CrcSegment &segment, T crc, bool reflectedInput)
+{
+    if constexpr (1 == sizeof(T))
+    {
+        return CalculateCRC8Clmul(crcTable, clmulConstants, segment.crc_DataPtr, segment.crc_Length, crc, 0, false, reflectedInput);
+    }
+    else if constexpr (2 == sizeof(T))
+    {
+        return CalculateCRC16Clmul(crcTable, clmulConstants, segment.crc_DataPtr, segment.crc_Length, crc, 0, false, reflectedInput);
+    }
+    else
+    {
+        return CalculateCRC32Clmul(crcTable, clmulConstants, segment.crc_DataPtr, segment.crc_Length, crc, 0, false, reflectedInput);
+    }
+}
+
+template <class T>
+static T CalculateCRCSegments(T crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, T crc_InitialValue, T crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    return CrcKernelDispatch<T>(reflectedOutput, reflectedInput, crc_XorValue, [&](auto kernel)
+    {
+        typedef decltype(kernel) Kernel;
+        T crc = crc_InitialValue;
+
+        for (uint32_t segment = 0U; segment < nSegments; segment++)
+        {
+            if ((nullptr != clmulConstants) && (crc_Segments[segment].crc_Length >= CRC_SEGMENTS_CLMUL_LENGTH))
+            {
+                crc = CrcSegmentClmul<T>(crcTable, clmulConstants, crc_Segments[segment], crc, reflectedInput);
+            }
+            else
+            {
+                crc = Kernel::Update(crcTable, crc_Segments[segment].crc_DataPtr, crc_Segments[segment].crc_Length, crc);
+            }
+        }
+
+        return Kernel::Finalize(crc, crc_XorValue);
+    });
+}
+
+// crcTable from Crc8TableGenerator(), clmulConstants from CrcClmulConstantsGenerator() with the same polynomial or
+// nullptr for table only. Result is the same as CalculateCRC8() of all segments one after another.
+uint8_t CalculateCRC8Segments(uint8_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC8, CRC_STATS_SEGMENTS, CrcStatsLength(crc_Segments, nSegments));
+
+    return CalculateCRCSegments<uint8_t>(crcTable, clmulConstants, crc_Segments, nSegments, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable from Crc16TableGenerator(), clmulConstants from CrcClmulConstantsGenerator() with the same polynomial or
+// nullptr for table only. Result is the same as CalculateCRC16() of all segments one after another.
+uint16_t CalculateCRC16Segments(uint16_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC16, CRC_STATS_SEGMENTS, CrcStatsLength(crc_Segments, nSegments));
+
+    return CalculateCRCSegments<uint16_t>(crcTable, clmulConstants, crc_Segments, nSegments, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
+
+// crcTable from Crc32TableGenerator(), clmulConstants from CrcClmulConstantsGenerator() with the same polynomial or
+// nullptr for table only. Result is the same as CalculateCRC32() of all segments one after another.
+uint32_t CalculateCRC32Segments(uint32_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput)
+{
+    CRC_STATS_SCOPE(CRC_STATS_MODEL_CRC32, CRC_STATS_SEGMENTS, CrcStatsLength(crc_Segments, nSegments));
+
+    return CalculateCRCSegments<uint32_t>(crcTable, clmulConstants, crc_Segments, nSegments, crc_InitialValue, crc_XorValue, reflectedOutput, reflectedInput);
+}
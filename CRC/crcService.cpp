@@ -0,0 +1,514 @@
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#include "crcService.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+extern void CalculateCRC8Batch(uint8_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint8_t crcResults[]);
+extern void CalculateCRC16Batch(uint16_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint16_t crcResults[]);
+extern void CalculateCRC32Batch(uint32_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint32_t crcResults[]);
+
+// Messages up to this length are calculated in batches, longer ones one at a time with the clmul kernel
+#define CRC_SERVICE_BATCH_LENGTH    256U
+
+#define CRC_SERVICE_EVENTS          64U
+
+struct CrcServiceServer::Connection
+{
+    int fd;
+    int attachFd;                   // descriptor received with SCM_RIGHTS, taken by the next attach request
+    const uint8_t *shared;
+    size_t sharedSize;
+    std::vector<uint8_t> input;
+    size_t parsed;                  // input bytes of parsed requests, removed after they are served
+    std::vector<uint8_t> output;
+    uint32_t events;                // registered epoll events
+    bool closing;
+};
+
+// Data points into the input buffer or the shared buffer of the connection
+struct CrcServiceServer::Pending
+{
+    Connection *connection;
+    uint32_t id;
+    const uint8_t *data;
+    uint32_t length;
+};
+
+CrcServiceServer::CrcServiceServer() : listenFd(-1), epollFd(-1), stopFd(-1)
+{
+}
+
+CrcServiceServer::~CrcServiceServer()
+{
+    while (!connections.empty())
+    {
+        Close(connections.back());
+    }
+    if (listenFd >= 0)
+    {
+        close(listenFd);
+        unlink(socketPath.data());
+    }
+    if (epollFd >= 0)
+    {
+        close(epollFd);
+    }
+    if (stopFd >= 0)
+    {
+        close(stopFd);
+    }
+}
+
+bool CrcServiceServer::Open(const char *path)
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if ((listenFd >= 0) || (strlen(path) >= sizeof(address.sun_path)))
+    {
+        return false;
+    }
+    strcpy(address.sun_path, path);
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    stopFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if ((epollFd < 0) || (stopFd < 0) || (listenFd < 0))
+    {
+        return false;
+    }
+
+    // A socket left by an earlier server is replaced, any other file is kept
+    struct stat status;
+    if (0 == lstat(path, &status))
+    {
+        if (!S_ISSOCK(status.st_mode) || (0 != unlink(path)))
+        {
+            close(listenFd);
+            listenFd = -1;
+            return false;
+        }
+    }
+    if ((0 != bind(listenFd, (struct sockaddr *)&address, sizeof(address))) || (0 != listen(listenFd, SOMAXCONN)))
+    {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    socketPath.assign(path, path + strlen(path) + 1);
+
+    // Listening socket and stop event are told apart from connections by their data pointer
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = &listenFd;
+    if (0 != epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event))
+    {
+        return false;
+    }
+    event.data.ptr = &stopFd;
+    return 0 == epoll_ctl(epollFd, EPOLL_CTL_ADD, stopFd, &event);
+}
+
+void CrcServiceServer::Stop()
+{
+    uint64_t one = 1;
+    ssize_t written = write(stopFd, &one, sizeof(one));
+    (void)written;
+}
+
+void CrcServiceServer::Run()
+{
+    std::vector<Pending> pending[CRC_MODEL_COUNT];
+    std::vector<Connection *> active;
+    struct epoll_event events[CRC_SERVICE_EVENTS];
+    bool running = (epollFd >= 0);
+
+    while (running)
+    {
+        int nEvents = epoll_wait(epollFd, events, CRC_SERVICE_EVENTS, -1);
+        if (nEvents < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            break;
+        }
+
+        // Read and parse every ready connection, an fd is reported once per epoll_wait()
+        for (int i = 0; i < nEvents; i++)
+        {
+            if (&stopFd == events[i].data.ptr)
+            {
+                running = false;
+                continue;
+            }
+            if (&listenFd == events[i].data.ptr)
+            {
+                Accept();
+                continue;
+            }
+
+            Connection *connection = (Connection *)events[i].data.ptr;
+            if (0 != (events[i].events & EPOLLIN))
+            {
+                if (!Read(*connection))
+                {
+                    connection->closing = true;
+                }
+                Parse(*connection, pending);
+            }
+            else if (0 != (events[i].events & (EPOLLERR | EPOLLHUP)))
+            {
+                connection->closing = true;
+            }
+            active.push_back(connection);
+        }
+
+        // Every model's requests of this iteration as one batch
+        for (uint32_t id = 0; id < CRC_MODEL_COUNT; id++)
+        {
+            if (!pending[id].empty())
+            {
+                Serve(pending[id], (CrcModelId)id);
+                pending[id].clear();
+            }
+        }
+
+        for (Connection *connection : active)
+        {
+            connection->input.erase(connection->input.begin(), connection->input.begin() + connection->parsed);
+            connection->parsed = 0;
+            if (!Write(*connection) || connection->closing)
+            {
+                Close(connection);
+            }
+        }
+        active.clear();
+    }
+}
+
+void CrcServiceServer::Accept()
+{
+    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    Connection *connection = new Connection();
+    connection->fd = fd;
+    connection->attachFd = -1;
+    connection->shared = nullptr;
+    connection->sharedSize = 0;
+    connection->parsed = 0;
+    connection->events = EPOLLIN;
+    connection->closing = false;
+
+    struct epoll_event event;
+    event.events = EPOLLIN;
+    event.data.ptr = connection;
+    if (0 != epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event))
+    {
+        close(fd);
+        delete connection;
+        return;
+    }
+    connections.push_back(connection);
+}
+
+// Appends up to CRC_SERVICE_READ_LIMIT bytes to the input, false at end of stream or on error
+bool CrcServiceServer::Read(Connection &connection)
+{
+    size_t limit = connection.input.size() + CRC_SERVICE_READ_LIMIT;
+
+    while (connection.input.size() < limit)
+    {
+        size_t size = connection.input.size();
+        connection.input.resize(limit);
+
+        struct iovec vector;
+        vector.iov_base = connection.input.data() + size;
+        vector.iov_len = limit - size;
+
+        union
+        {
+            char buffer[CMSG_SPACE(sizeof(int))];
+            struct cmsghdr align;
+        } control;
+
+        struct msghdr message;
+        memset(&message, 0, sizeof(message));
+        message.msg_iov = &vector;
+        message.msg_iovlen = 1;
+        message.msg_control = control.buffer;
+        message.msg_controllen = sizeof(control.buffer);
+
+        ssize_t received = recvmsg(connection.fd, &message, MSG_CMSG_CLOEXEC);
+        connection.input.resize(size + ((received > 0) ? (size_t)received : 0));
+        if (received < 0)
+        {
+            message.msg_controllen = 0;
+        }
+
+        for (struct cmsghdr *header = CMSG_FIRSTHDR(&message); nullptr != header; header = CMSG_NXTHDR(&message, header))
+        {
+            if ((SOL_SOCKET == header->cmsg_level) && (SCM_RIGHTS == header->cmsg_type))
+            {
+                if (connection.attachFd >= 0)
+                {
+                    close(connection.attachFd);
+                }
+                memcpy(&connection.attachFd, CMSG_DATA(header), sizeof(int));
+            }
+        }
+
+        if (0 == received)
+        {
+            return false;
+        }
+        if (received < 0)
+        {
+            return (EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno);
+        }
+    }
+    return true;
+}
+
+// Size of the descriptor can no longer shrink
+static bool CrcServiceSealed(int fd)
+{
+    int seals = fcntl(fd, F_GET_SEALS);
+    return (seals >= 0) && (0 != (seals & F_SEAL_SHRINK));
+}
+
+// Complete requests of the input go to the pending list of their model, others are answered right away
+void CrcServiceServer::Parse(Connection &connection, std::vector<Pending> pending[])
+{
+    while (connection.input.size() - connection.parsed >= sizeof(CrcServiceRequest))
+    {
+        CrcServiceRequest request;
+        memcpy(&request, connection.input.data() + connection.parsed, sizeof(request));
+
+        CrcServiceResponse response;
+        response.id = request.id;
+        response.status = CRC_SERVICE_OK;
+        response.crc = 0;
+
+        if (CRC_SERVICE_INLINE == request.type)
+        {
+            if (request.length > CRC_SERVICE_MAX_INLINE)
+            {
+                connection.closing = true;
+                return;
+            }
+            if (connection.input.size() - connection.parsed < sizeof(request) + request.length)
+            {
+                return;
+            }
+            connection.parsed += sizeof(request) + request.length;
+
+            if (request.model >= CRC_MODEL_COUNT)
+            {
+                response.status = CRC_SERVICE_UNKNOWN_MODEL;
+                Reply(connection, response);
+                continue;
+            }
+            const uint8_t *data = connection.input.data() + connection.parsed - request.length;
+            pending[request.model].push_back({&connection, request.id, data, request.length});
+        }
+        else if (CRC_SERVICE_SHARED == request.type)
+        {
+            connection.parsed += sizeof(request);
+
+            if (request.model >= CRC_MODEL_COUNT)
+            {
+                response.status = CRC_SERVICE_UNKNOWN_MODEL;
+            }
+            else if ((request.offset > connection.sharedSize) || (request.length > connection.sharedSize - request.offset))
+            {
+                response.status = CRC_SERVICE_OUT_OF_BOUNDS;
+            }
+            else
+            {
+                pending[request.model].push_back({&connection, request.id, connection.shared + request.offset, request.length});
+                continue;
+            }
+            Reply(connection, response);
+        }
+        else if (CRC_SERVICE_ATTACH == request.type)
+        {
+            connection.parsed += sizeof(request);
+            response.status = CRC_SERVICE_ATTACH_FAILED;
+
+            // One buffer per connection: pending requests of this iteration may point into an attached one.
+            // Only a sealed regular file is mapped, a client shrinking it later would let reads past its end raise SIGBUS.
+            struct stat status;
+            if ((connection.attachFd >= 0) && (nullptr == connection.shared) && CrcServiceSealed(connection.attachFd) &&
+                (0 == fstat(connection.attachFd, &status)) && S_ISREG(status.st_mode) && (status.st_size > 0))
+            {
+                void *shared = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, connection.attachFd, 0);
+                if (MAP_FAILED != shared)
+                {
+                    connection.shared = (const uint8_t *)shared;
+                    connection.sharedSize = (size_t)status.st_size;
+                    response.status = CRC_SERVICE_OK;
+                }
+            }
+            if (connection.attachFd >= 0)
+            {
+                close(connection.attachFd);
+                connection.attachFd = -1;
+            }
+            Reply(connection, response);
+        }
+        else
+        {
+            connection.closing = true;
+            return;
+        }
+    }
+}
+
+template <class T, class Batch>
+static void CrcServiceBatch(const CrcRegisteredModel *model, const T *table, Batch batch, const std::vector<const uint8_t *> &dataPtrs, const std::vector<uint32_t> &lengths, std::vector<uint64_t> &crcResults)
+{
+    const CrcModelParameters &parameters = model->parameters;
+    std::vector<T> results(dataPtrs.size());
+
+    batch(const_cast<T *>(table), dataPtrs.data(), lengths.data(), (uint32_t)dataPtrs.size(), (T)parameters.initialValue, (T)parameters.xorValue,
+          parameters.reflectedOutput, parameters.reflectedInput, results.data());
+    crcResults.assign(results.begin(), results.end());
+}
+
+void CrcServiceServer::Serve(std::vector<Pending> &pending, CrcModelId id)
+{
+    const CrcRegisteredModel *model = CrcGetModel(id);
+    uint8_t width = model->parameters.width;
+    std::vector<const uint8_t *> dataPtrs;
+    std::vector<uint32_t> lengths;
+    std::vector<uint32_t> indices;
+    std::vector<uint64_t> crcResults;
+    CrcServiceResponse response;
+
+    response.status = CRC_SERVICE_OK;
+    for (uint32_t i = 0; i < pending.size(); i++)
+    {
+        if (((8 == width) || (16 == width) || (32 == width)) && (pending[i].length <= CRC_SERVICE_BATCH_LENGTH))
+        {
+            dataPtrs.push_back(pending[i].data);
+            lengths.push_back(pending[i].length);
+            indices.push_back(i);
+            continue;
+        }
+        response.id = pending[i].id;
+        response.crc = model->Calculate(pending[i].data, pending[i].length);
+        Reply(*pending[i].connection, response);
+    }
+
+    if (dataPtrs.empty())
+    {
+        return;
+    }
+    if (8 == width)
+    {
+        CrcServiceBatch(model, model->Table8(), CalculateCRC8Batch, dataPtrs, lengths, crcResults);
+    }
+    else if (16 == width)
+    {
+        CrcServiceBatch(model, model->Table16(), CalculateCRC16Batch, dataPtrs, lengths, crcResults);
+    }
+    else
+    {
+        CrcServiceBatch(model, model->Table32(), CalculateCRC32Batch, dataPtrs, lengths, crcResults);
+    }
+
+    for (uint32_t i = 0; i < indices.size(); i++)
+    {
+        response.id = pending[indices[i]].id;
+        response.crc = crcResults[i];
+        Reply(*pending[indices[i]].connection, response);
+    }
+}
+
+void CrcServiceServer::Reply(Connection &connection, const CrcServiceResponse &response)
+{
+    const uint8_t *bytes = (const uint8_t *)&response;
+    connection.output.insert(connection.output.end(), bytes, bytes + sizeof(response));
+}
+
+// Sends what the socket takes, the rest waits for EPOLLOUT. False on error.
+bool CrcServiceServer::Write(Connection &connection)
+{
+    size_t sent = 0;
+
+    while (sent < connection.output.size())
+    {
+        ssize_t written = send(connection.fd, connection.output.data() + sent, connection.output.size() - sent, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (written < 0)
+        {
+            if ((EAGAIN == errno) || (EWOULDBLOCK == errno))
+            {
+                break;
+            }
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return false;
+        }
+        sent += (size_t)written;
+    }
+    connection.output.erase(connection.output.begin(), connection.output.begin() + sent);
+
+    // Full output stops reading, the client has to take its responses first
+    uint32_t events = (connection.output.size() > CRC_SERVICE_OUTPUT_LIMIT) ? 0U : (uint32_t)EPOLLIN;
+    if (!connection.output.empty())
+    {
+        events |= EPOLLOUT;
+    }
+    if (events != connection.events)
+    {
+        struct epoll_event event;
+        event.events = events;
+        event.data.ptr = &connection;
+        if (0 != epoll_ctl(epollFd, EPOLL_CTL_MOD, connection.fd, &event))
+        {
+            return false;
+        }
+        connection.events = events;
+    }
+    return true;
+}
+
+void CrcServiceServer::Close(Connection *connection)
+{
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, connection->fd, nullptr);
+    close(connection->fd);
+    if (connection->attachFd >= 0)
+    {
+        close(connection->attachFd);
+    }
+    if (nullptr != connection->shared)
+    {
+        munmap((void *)connection->shared, connection->sharedSize);
+    }
+    connections.erase(std::find(connections.begin(), connections.end(), connection));
+    delete connection;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,152 @@
+#ifndef CRC_SERVICE_H
+#define CRC_SERVICE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#include "crcRegistry.h"
+
+//CRC service for the processes of one host: one daemon holds the tables of the catalogue models, clients send
+//requests over a Unix domain stream socket (Linux only).
+//
+//Data is sent inline after the request header, or without copy from a shared memory buffer: the client creates a
+//memfd, seals its size, maps it and passes the descriptor once with SCM_RIGHTS, later requests only give offset and
+//length in it. The server maps only regular files sealed against shrinking, so no client can make its reads fault.
+//
+//The server is one epoll loop. Requests read in one loop iteration are grouped per model, short messages of 8, 16
+//and 32 bit models go through CalculateCRCxxBatch() (interleaved lookups), longer ones through the model's clmul
+//kernel. Every request read is answered in the same iteration, so nothing waits for a batch to fill: latency is one
+//iteration, which is bounded by reading at most CRC_SERVICE_READ_LIMIT bytes per connection and iteration.
+//Responses carry the request id and come in any order.
+//
+//Memory per connection is bounded as well: while more than CRC_SERVICE_OUTPUT_LIMIT response bytes wait for a client
+//which does not read them, its socket is not read. CalculateBatch() keeps at most that many responses outstanding.
+//
+//Example:
+//    CrcServiceClient client;
+//    client.Connect("/tmp/crc.sock");
+//    uint64_t crc;
+//    client.Calculate(CRC_MODEL_CRC32, message, sizeof(message), crc);
+
+#define CRC_SERVICE_DEFAULT_PATH    "/tmp/crcService.sock"
+
+// Bytes read from one connection per loop iteration
+#define CRC_SERVICE_READ_LIMIT      (256U * 1024U)
+
+// Queued response bytes of one connection above which its requests are not read until the client takes them
+#define CRC_SERVICE_OUTPUT_LIMIT    (64U * 1024U)
+
+// Largest inline message, larger ones have to use the shared buffer
+#define CRC_SERVICE_MAX_INLINE      (64U * 1024U)
+
+enum CrcServiceRequestType
+{
+    CRC_SERVICE_INLINE,         // length bytes of data follow the header
+    CRC_SERVICE_SHARED,         // data is at offset in the shared buffer
+    CRC_SERVICE_ATTACH          // memfd of the shared buffer is sent with this header as SCM_RIGHTS
+};
+
+enum CrcServiceStatus
+{
+    CRC_SERVICE_OK,
+    CRC_SERVICE_UNKNOWN_MODEL,
+    CRC_SERVICE_OUT_OF_BOUNDS,  // shared request outside of the attached buffer or no buffer attached
+    CRC_SERVICE_ATTACH_FAILED
+};
+
+struct CrcServiceRequest
+{
+    uint32_t id;
+    uint16_t type;              // CrcServiceRequestType
+    uint16_t model;             // CrcModelId
+    uint32_t length;
+    uint32_t reserved;
+    uint64_t offset;
+};
+
+struct CrcServiceResponse
+{
+    uint32_t id;
+    uint32_t status;            // CrcServiceStatus
+    uint64_t crc;
+};
+
+class CrcServiceServer
+{
+public:
+    CrcServiceServer();
+    ~CrcServiceServer();
+
+    CrcServiceServer(const CrcServiceServer &) = delete;
+    CrcServiceServer &operator=(const CrcServiceServer &) = delete;
+
+    // Creates the socket. An old socket at path is replaced, Open() fails if path is any other file.
+    bool Open(const char *path);
+
+    // Serves the clients until Stop()
+    void Run();
+
+    // From any thread or a signal handler
+    void Stop();
+
+private:
+    struct Connection;
+    struct Pending;
+
+    void Accept();
+    bool Read(Connection &connection);
+    void Parse(Connection &connection, std::vector<Pending> pending[]);
+    void Serve(std::vector<Pending> &pending, CrcModelId id);
+    void Reply(Connection &connection, const CrcServiceResponse &response);
+    bool Write(Connection &connection);
+    void Close(Connection *connection);
+
+    int listenFd;
+    int epollFd;
+    int stopFd;
+    std::vector<char> socketPath;
+    std::vector<Connection *> connections;
+};
+
+class CrcServiceClient
+{
+public:
+    CrcServiceClient();
+    ~CrcServiceClient();
+
+    CrcServiceClient(const CrcServiceClient &) = delete;
+    CrcServiceClient &operator=(const CrcServiceClient &) = delete;
+
+    bool Connect(const char *path);
+
+    // Shared buffer of size bytes, data placed in it is sent without copy. Returns nullptr on error.
+    uint8_t *AttachSharedBuffer(size_t size);
+
+    // Queues a request and returns its id. Data inside the shared buffer is sent as reference, other data inline.
+    uint32_t Submit(CrcModelId id, const uint8_t *crc_DataPtr, uint32_t crc_Length);
+
+    // Sends the queued requests
+    bool Flush();
+
+    // Next response, blocks until one arrives
+    bool Receive(CrcServiceResponse &response);
+
+    // One request, round trip
+    bool Calculate(CrcModelId id, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t &crc);
+
+    // nMessages requests in one write, crcResults[i] is the CRC of message i
+    bool CalculateBatch(CrcModelId id, const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint64_t crcResults[]);
+
+private:
+    bool SendAll(const void *data, size_t length);
+
+    int fd;
+    uint8_t *sharedBuffer;
+    size_t sharedSize;
+    uint32_t nextId;
+    std::vector<uint8_t> sendBuffer;
+    std::vector<uint8_t> receiveBuffer;
+};
+
+#endif /* CRC_SERVICE_H */
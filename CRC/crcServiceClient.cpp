@@ -0,0 +1,257 @@
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#include "crcService.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+CrcServiceClient::CrcServiceClient() : fd(-1), sharedBuffer(nullptr), sharedSize(0), nextId(1)
+{
+}
+
+CrcServiceClient::~CrcServiceClient()
+{
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    if (nullptr != sharedBuffer)
+    {
+        munmap(sharedBuffer, sharedSize);
+    }
+}
+
+bool CrcServiceClient::Connect(const char *path)
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if ((fd >= 0) || (strlen(path) >= sizeof(address.sun_path)))
+    {
+        return false;
+    }
+    strcpy(address.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+    {
+        return false;
+    }
+    if (0 != connect(fd, (struct sockaddr *)&address, sizeof(address)))
+    {
+        close(fd);
+        fd = -1;
+        return false;
+    }
+    return true;
+}
+
+// Waits for the answer of the attach request, so no other request may be outstanding
+uint8_t *CrcServiceClient::AttachSharedBuffer(size_t size)
+{
+    if ((fd < 0) || (nullptr != sharedBuffer) || (0 == size) || !Flush())
+    {
+        return nullptr;
+    }
+
+    // Size is sealed, the server only maps buffers which cannot shrink under its reads
+    int memoryFd = memfd_create("crcService", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (memoryFd < 0)
+    {
+        return nullptr;
+    }
+    bool sealed = (0 == ftruncate(memoryFd, (off_t)size)) && (0 == fcntl(memoryFd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL));
+    void *buffer = sealed ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0) : MAP_FAILED;
+    if (MAP_FAILED == buffer)
+    {
+        close(memoryFd);
+        return nullptr;
+    }
+
+    CrcServiceRequest request;
+    memset(&request, 0, sizeof(request));
+    request.id = nextId++;
+    request.type = CRC_SERVICE_ATTACH;
+
+    struct iovec vector;
+    vector.iov_base = &request;
+    vector.iov_len = sizeof(request);
+
+    union
+    {
+        char buffer[CMSG_SPACE(sizeof(int))];
+        struct cmsghdr align;
+    } control;
+    memset(&control, 0, sizeof(control));
+
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = control.buffer;
+    message.msg_controllen = sizeof(control.buffer);
+
+    struct cmsghdr *header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(header), &memoryFd, sizeof(int));
+
+    // The descriptor goes with the first byte, the rest of the header may follow in further writes
+    ssize_t sent;
+    do
+    {
+        sent = sendmsg(fd, &message, MSG_NOSIGNAL);
+    } while ((sent < 0) && (EINTR == errno));
+    close(memoryFd);
+
+    CrcServiceResponse response;
+    if ((sent <= 0) || !SendAll((const uint8_t *)&request + sent, sizeof(request) - (size_t)sent) || !Receive(response) ||
+        (request.id != response.id) || (CRC_SERVICE_OK != response.status))
+    {
+        munmap(buffer, size);
+        return nullptr;
+    }
+
+    sharedBuffer = (uint8_t *)buffer;
+    sharedSize = size;
+    return sharedBuffer;
+}
+
+uint32_t CrcServiceClient::Submit(CrcModelId id, const uint8_t *crc_DataPtr, uint32_t crc_Length)
+{
+    CrcServiceRequest request;
+    memset(&request, 0, sizeof(request));
+    request.id = nextId++;
+    request.model = (uint16_t)id;
+    request.length = crc_Length;
+
+    bool shared = (nullptr != sharedBuffer) && (crc_DataPtr >= sharedBuffer) && ((size_t)(crc_DataPtr - sharedBuffer) <= sharedSize) &&
+                  (crc_Length <= sharedSize - (size_t)(crc_DataPtr - sharedBuffer));
+    if (shared)
+    {
+        request.type = CRC_SERVICE_SHARED;
+        request.offset = (uint64_t)(crc_DataPtr - sharedBuffer);
+    }
+    else
+    {
+        if (crc_Length > CRC_SERVICE_MAX_INLINE)
+        {
+            return 0;
+        }
+        request.type = CRC_SERVICE_INLINE;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)&request;
+    sendBuffer.insert(sendBuffer.end(), bytes, bytes + sizeof(request));
+    if (!shared)
+    {
+        sendBuffer.insert(sendBuffer.end(), crc_DataPtr, crc_DataPtr + crc_Length);
+    }
+    return request.id;
+}
+
+bool CrcServiceClient::Flush()
+{
+    bool sent = SendAll(sendBuffer.data(), sendBuffer.size());
+    sendBuffer.clear();
+    return sent;
+}
+
+bool CrcServiceClient::Receive(CrcServiceResponse &response)
+{
+    while (receiveBuffer.size() < sizeof(response))
+    {
+        uint8_t buffer[4096];
+        ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+        if (received <= 0)
+        {
+            if ((received < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+            return false;
+        }
+        receiveBuffer.insert(receiveBuffer.end(), buffer, buffer + received);
+    }
+
+    memcpy(&response, receiveBuffer.data(), sizeof(response));
+    receiveBuffer.erase(receiveBuffer.begin(), receiveBuffer.begin() + sizeof(response));
+    return true;
+}
+
+bool CrcServiceClient::Calculate(CrcModelId id, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t &crc)
+{
+    return CalculateBatch(id, &crc_DataPtr, &crc_Length, 1, &crc);
+}
+
+// Ids of one chunk are consecutive, so the response id gives the message index. Chunks of at most
+// CRC_SERVICE_OUTPUT_LIMIT response bytes, so the server never stops reading while this client is still sending.
+bool CrcServiceClient::CalculateBatch(CrcModelId id, const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint64_t crcResults[])
+{
+    const uint32_t chunkMessages = CRC_SERVICE_OUTPUT_LIMIT / sizeof(CrcServiceResponse);
+    bool valid = true;
+
+    for (uint32_t first = 0; first < nMessages; first += chunkMessages)
+    {
+        uint32_t firstId = nextId;
+        uint32_t nChunk = (nMessages - first < chunkMessages) ? (nMessages - first) : chunkMessages;
+
+        for (uint32_t i = first; i < first + nChunk; i++)
+        {
+            if (0 == Submit(id, crc_DataPtrs[i], crc_Lengths[i]))
+            {
+                sendBuffer.clear();
+                nextId = firstId;
+                return false;
+            }
+        }
+        if (!Flush())
+        {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < nChunk; i++)
+        {
+            CrcServiceResponse response;
+            if (!Receive(response) || (response.id - firstId >= nChunk))
+            {
+                return false;
+            }
+            crcResults[first + response.id - firstId] = response.crc;
+            valid = valid && (CRC_SERVICE_OK == response.status);
+        }
+    }
+    return valid;
+}
+
+bool CrcServiceClient::SendAll(const void *data, size_t length)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    while (length > 0)
+    {
+        ssize_t sent = send(fd, bytes, length, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            return false;
+        }
+        bytes += sent;
+        length -= (size_t)sent;
+    }
+    return true;
+}
+
+#endif /* __linux__ */
@@ -0,0 +1,695 @@
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "crcCombine.h"
+#include "crcSolver.h"
+#include "crcThreadPool.h"
+
+// Polynomials calculated together in one loop, the compiler keeps the lanes in vector registers
+#define CRC_SOLVER_LANES        8U
+
+// Polynomials per thread pool task
+#define CRC_SOLVER_TASK_SIZE    (16U * 1024U)
+
+// Largest searched space, 2^32 polynomials
+#define CRC_SOLVER_MAX_SEARCH   32U
+
+static const uint8_t crcSolverCheckMessage[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+// Polynomial over GF(2) of any degree, bit i of word i/64 is the coefficient of x^i
+typedef std::vector<uint64_t> CrcGf2Polynomial;
+
+static uint64_t CrcSolverMask(uint8_t width)
+{
+    return (64 == width) ? ~0ULL : ((1ULL << width) - 1U);
+}
+
+static int64_t CrcGf2Degree(const CrcGf2Polynomial &a)
+{
+    for (size_t i = a.size(); i > 0; i--)
+    {
+        if (0 != a[i - 1])
+        {
+            return 64 * (int64_t)(i - 1) + 63 - __builtin_clzll(a[i - 1]);
+        }
+    }
+    return -1;
+}
+
+static uint64_t CrcGf2Coefficient(const CrcGf2Polynomial &a, uint64_t exponent)
+{
+    return (a[exponent / 64] >> (exponent % 64)) & 0x01;
+}
+
+// a ^= b * x^shift
+static void CrcGf2XorShifted(CrcGf2Polynomial &a, const CrcGf2Polynomial &b, uint64_t shift)
+{
+    uint64_t wordShift = shift / 64;
+    uint32_t bitShift = shift % 64;
+
+    if (a.size() < b.size() + wordShift + 1)
+    {
+        a.resize(b.size() + wordShift + 1, 0);
+    }
+
+    for (size_t i = 0; i < b.size(); i++)
+    {
+        a[i + wordShift] ^= b[i] << bitShift;
+        if (0 != bitShift)
+        {
+            a[i + wordShift + 1] ^= b[i] >> (64 - bitShift);
+        }
+    }
+}
+
+// a mod b, a / b is returned in quotient if it is not nullptr
+static CrcGf2Polynomial CrcGf2Mod(CrcGf2Polynomial a, const CrcGf2Polynomial &b, CrcGf2Polynomial *quotient)
+{
+    int64_t degreeB = CrcGf2Degree(b);
+
+    for (int64_t degreeA = CrcGf2Degree(a); degreeA >= degreeB; degreeA = CrcGf2Degree(a))
+    {
+        CrcGf2XorShifted(a, b, degreeA - degreeB);
+        if (nullptr != quotient)
+        {
+            CrcGf2XorShifted(*quotient, CrcGf2Polynomial(1, 0x01), degreeA - degreeB);
+        }
+    }
+
+    return a;
+}
+
+static CrcGf2Polynomial CrcGf2Gcd(CrcGf2Polynomial a, CrcGf2Polynomial b)
+{
+    while (CrcGf2Degree(b) >= 0)
+    {
+        CrcGf2Polynomial remainder = CrcGf2Mod(a, b, nullptr);
+        a.swap(b);
+        b.swap(remainder);
+    }
+
+    return a;
+}
+
+// (a ^ b)(x) * x^width + (registerA ^ registerB)(x), which is divisible by the polynomial for messages of the same length
+static CrcGf2Polynomial CrcSolverPairPolynomial(const CrcSolverSample &a, const CrcSolverSample &b, uint64_t registerA, uint64_t registerB, uint8_t width, bool reflectedInput)
+{
+    uint64_t nBits = 8ULL * a.crc_Length;
+    CrcGf2Polynomial pair((nBits + width) / 64 + 1, 0);
+
+    pair[0] = registerA ^ registerB;
+    for (uint32_t i = 0; i < a.crc_Length; i++)
+    {
+        uint8_t data = a.crc_DataPtr[i] ^ b.crc_DataPtr[i];
+        data = reflectedInput ? crcByteReflection.entry[data] : data;
+
+        // first bit of the message is the highest coefficient
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if ((data >> (7 - bit)) & 0x01)
+            {
+                uint64_t exponent = width + nBits - 1 - (8ULL * i + bit);
+                pair[exponent / 64] ^= 1ULL << (exponent % 64);
+            }
+        }
+    }
+
+    return pair;
+}
+
+// g mod (x^width + candidates[lane]) for all lanes
+static void CrcSolverModLanes(const CrcGf2Polynomial &g, int64_t degreeG, const uint64_t candidates[CRC_SOLVER_LANES], uint8_t width, uint64_t remainders[CRC_SOLVER_LANES])
+{
+    uint64_t mask = CrcSolverMask(width);
+    uint64_t crc[CRC_SOLVER_LANES] = { 0 };
+
+    for (int64_t exponent = degreeG; exponent >= 0; exponent--)
+    {
+        uint64_t data = CrcGf2Coefficient(g, exponent);
+
+        for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+        {
+            uint64_t topBit = (crc[lane] >> (width - 1)) & 0x01;
+            crc[lane] = (((crc[lane] << 1) | data) & mask) ^ (candidates[lane] & (0 - topBit));
+        }
+    }
+
+    for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+    {
+        remainders[lane] = crc[lane];
+    }
+}
+
+// Normal register with initial value 0 of one message for all lanes, powers[lane] = x^(8*crc_Length) mod P is the
+// register of initial value 1 over as many zero bytes
+static void CrcSolverRegisterLanes(const CrcSolverSample &sample, const uint64_t polynomials[CRC_SOLVER_LANES], uint8_t width, bool reflectedInput,
+                                   uint64_t registers[CRC_SOLVER_LANES], uint64_t powers[CRC_SOLVER_LANES])
+{
+    uint64_t mask = CrcSolverMask(width);
+    uint64_t crc[CRC_SOLVER_LANES] = { 0 };
+    uint64_t power[CRC_SOLVER_LANES];
+
+    for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+    {
+        power[lane] = 0x01;
+    }
+
+    for (uint32_t i = 0; i < sample.crc_Length; i++)
+    {
+        uint8_t data = reflectedInput ? crcByteReflection.entry[sample.crc_DataPtr[i]] : sample.crc_DataPtr[i];
+
+        for (int8_t bit = 7; bit >= 0; bit--)
+        {
+            uint64_t dataBit = (data >> bit) & 0x01;
+
+            for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+            {
+                uint64_t topBit = ((crc[lane] >> (width - 1)) & 0x01) ^ dataBit;
+                crc[lane] = ((crc[lane] << 1) & mask) ^ (polynomials[lane] & (0 - topBit));
+
+                uint64_t powerTopBit = (power[lane] >> (width - 1)) & 0x01;
+                power[lane] = ((power[lane] << 1) & mask) ^ (polynomials[lane] & (0 - powerTopBit));
+            }
+        }
+    }
+
+    for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+    {
+        registers[lane] = crc[lane];
+        powers[lane] = power[lane];
+    }
+}
+
+// a[lane] * b[lane] mod P for all lanes
+static void CrcSolverMultiplyLanes(const uint64_t a[CRC_SOLVER_LANES], const uint64_t b[CRC_SOLVER_LANES], const uint64_t polynomials[CRC_SOLVER_LANES],
+                                   uint8_t width, uint64_t products[CRC_SOLVER_LANES])
+{
+    uint64_t mask = CrcSolverMask(width);
+    uint64_t product[CRC_SOLVER_LANES] = { 0 };
+
+    for (int8_t bit = width - 1; bit >= 0; bit--)
+    {
+        for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+        {
+            uint64_t topBit = (product[lane] >> (width - 1)) & 0x01;
+            product[lane] = ((product[lane] << 1) & mask) ^ (polynomials[lane] & (0 - topBit)) ^ (a[lane] & (0 - ((b[lane] >> bit) & 0x01)));
+        }
+    }
+
+    for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+    {
+        products[lane] = product[lane];
+    }
+}
+
+// Register after crc_Length zero bytes is linear in the register before them: columns[j] = x^(8*crc_Length + j) mod P
+static void CrcSolverShiftColumns(uint64_t polynomial, uint8_t width, uint32_t crc_Length, uint64_t columns[64])
+{
+    uint64_t mask = CrcSolverMask(width);
+    uint64_t column = CrcShift<uint64_t>(0x01, crc_Length, polynomial, width);
+
+    for (uint8_t j = 0; j < width; j++)
+    {
+        columns[j] = column;
+        column = ((column << 1) & mask) ^ (polynomial & (0 - ((column >> (width - 1)) & 0x01)));
+    }
+}
+
+static uint64_t CrcSolverApply(const uint64_t columns[64], uint8_t width, uint64_t value)
+{
+    uint64_t result = 0;
+
+    for (uint8_t j = 0; j < width; j++)
+    {
+        result ^= columns[j] & (0 - ((value >> j) & 0x01));
+    }
+
+    return result;
+}
+
+// Solves shift(init, length_i) ^ xor = values[i] for all samples, values[i] is the sample register xored with the
+// register of the message with initial value 0. Returns false if there is no solution.
+static bool CrcSolverInitialValue(uint64_t polynomial, uint8_t width, const CrcSolverSample samples[], const uint64_t values[], uint32_t nSamples,
+                                  uint64_t &initialValue, uint64_t &xorValue, bool &unique)
+{
+    uint64_t columns0[64];
+    uint64_t columns[64];
+    uint64_t basis[64] = { 0 };     // row with highest bit j, Gaussian elimination
+    uint8_t basisValue[64] = { 0 };
+    uint32_t rank = 0;
+
+    CrcSolverShiftColumns(polynomial, width, samples[0].crc_Length, columns0);
+
+    for (uint32_t i = 1; i < nSamples; i++)
+    {
+        uint64_t difference = values[i] ^ values[0];
+
+        if (samples[i].crc_Length == samples[0].crc_Length)
+        {
+            if (0 != difference)
+            {
+                return false;
+            }
+            continue;
+        }
+
+        CrcSolverShiftColumns(polynomial, width, samples[i].crc_Length, columns);
+
+        for (uint8_t row = 0; row < width; row++)
+        {
+            uint64_t equation = 0;
+            uint8_t value = (difference >> row) & 0x01;
+
+            for (uint8_t j = 0; j < width; j++)
+            {
+                equation |= (((columns[j] ^ columns0[j]) >> row) & 0x01) << j;
+            }
+
+            for (int8_t j = width - 1; (j >= 0) && (0 != equation); j--)
+            {
+                if (0 == ((equation >> j) & 0x01))
+                {
+                    continue;
+                }
+                if (0 == basis[j])
+                {
+                    basis[j] = equation;
+                    basisValue[j] = value;
+                    rank++;
+                    equation = 0;
+                    value = 0;
+                    break;
+                }
+                equation ^= basis[j];
+                value ^= basisValue[j];
+            }
+
+            if (0 != value)
+            {
+                return false;
+            }
+        }
+    }
+
+    // free variables are 0, pivots from the lowest one
+    initialValue = 0;
+    for (uint8_t j = 0; j < width; j++)
+    {
+        if (0 != basis[j])
+        {
+            uint64_t known = basis[j] & initialValue;
+            uint8_t parity = (uint8_t)(__builtin_popcountll(known) & 0x01);
+            initialValue |= (uint64_t)(basisValue[j] ^ parity) << j;
+        }
+    }
+
+    xorValue = values[0] ^ CrcSolverApply(columns0, width, initialValue);
+    unique = (rank == width);
+    return true;
+}
+
+// Sample registers without xor and output reflection (normal form)
+struct CrcSolverSearch
+{
+    uint8_t width;
+    bool reflectedInput;
+    bool reflectedOutput;
+    const CrcSolverSample *samples;
+    uint32_t nSamples;
+    std::vector<uint64_t> registers;
+};
+
+static void CrcSolverAddSolution(const CrcSolverSearch &search, uint64_t polynomial, uint64_t initialValue, uint64_t xorValue, bool unique, std::vector<CrcSolverResult> &solutions)
+{
+    CrcSolverResult result;
+
+    result.parameters.name = nullptr;
+    result.parameters.alias = nullptr;
+    result.parameters.width = search.width;
+    result.parameters.polynomial = polynomial;
+    result.parameters.initialValue = initialValue;
+    result.parameters.xorValue = xorValue;
+    result.parameters.reflectedInput = search.reflectedInput;
+    result.parameters.reflectedOutput = search.reflectedOutput;
+    result.parameters.check = CalculateCRCBitwise<uint64_t>(polynomial, crcSolverCheckMessage, sizeof(crcSolverCheckMessage), initialValue, xorValue,
+                                                            search.reflectedOutput, search.reflectedInput, search.width);
+    result.uniqueInitialValue = unique;
+
+    solutions.push_back(result);
+}
+
+// Initial and xor value for one polynomial, true if the polynomial is a solution
+static bool CrcSolverVerify(const CrcSolverSearch &search, uint64_t polynomial, std::vector<CrcSolverResult> &solutions)
+{
+    std::vector<uint64_t> values(search.nSamples);
+
+    for (uint32_t i = 0; i < search.nSamples; i++)
+    {
+        values[i] = search.registers[i] ^ CalculateCRCBitwise<uint64_t>(polynomial, search.samples[i].crc_DataPtr, search.samples[i].crc_Length, 0, 0,
+                                                                        false, search.reflectedInput, search.width);
+    }
+
+    uint64_t initialValue;
+    uint64_t xorValue;
+    bool unique;
+    if (!CrcSolverInitialValue(polynomial, search.width, search.samples, values.data(), search.nSamples, initialValue, xorValue, unique))
+    {
+        return false;
+    }
+
+    CrcSolverAddSolution(search, polynomial, initialValue, xorValue, unique, solutions);
+    return true;
+}
+
+// Candidate polynomials tried for GCD g (brute force if g is empty), 0 if none or beyond CRC_SOLVER_MAX_SEARCH bits
+static uint64_t CrcSolverCandidates(uint8_t width, const CrcGf2Polynomial &g)
+{
+    int64_t degreeG = CrcGf2Degree(g);
+
+    if (degreeG < 0)
+    {
+        return (width > CRC_SOLVER_MAX_SEARCH) ? 0 : (1ULL << (width - 1));
+    }
+    if (degreeG < width)
+    {
+        return 0;
+    }
+
+    // same choice as in CrcSolverDivisors()
+    uint64_t cofactorDegree = degreeG - width;
+    bool searchCofactor = (cofactorDegree < width);
+    uint64_t searchWidth = searchCofactor ? cofactorDegree : width;
+    bool oddOnly = !searchCofactor || (0 != (g[0] & 0x01));
+
+    if (0 == cofactorDegree)
+    {
+        return 1;
+    }
+    if (searchWidth > CRC_SOLVER_MAX_SEARCH)
+    {
+        return 0;
+    }
+    return oddOnly ? (1ULL << (searchWidth - 1)) : (1ULL << searchWidth);
+}
+
+// Polynomials from the GCD of the pair polynomials, initial and xor value by linear algebra
+static void CrcSolverDivisors(const CrcSolverSearch &search, const CrcGf2Polynomial &g, uint32_t maxResults, std::vector<CrcSolverResult> &solutions)
+{
+    uint8_t width = search.width;
+    uint64_t mask = CrcSolverMask(width);
+    int64_t degreeG = CrcGf2Degree(g);
+    std::mutex lock;
+    std::atomic<bool> done(false);
+
+    if (degreeG < width)
+    {
+        return;
+    }
+
+    uint64_t cofactorDegree = degreeG - width;
+    if (0 == cofactorDegree)
+    {
+        CrcSolverVerify(search, g[0] & mask, solutions);
+        return;
+    }
+
+    // search the smaller of the two divisors, polynomial or cofactor
+    bool searchCofactor = (cofactorDegree < width);
+    uint8_t searchWidth = searchCofactor ? (uint8_t)cofactorDegree : width;
+    // divisors of a polynomial with x^0 term have the x^0 term
+    bool oddOnly = !searchCofactor || (0 != (g[0] & 0x01));
+
+    if (searchWidth > CRC_SOLVER_MAX_SEARCH)
+    {
+        return;
+    }
+
+    uint64_t nCandidates = (oddOnly ? (1ULL << (searchWidth - 1)) : (1ULL << searchWidth));
+    CrcTaskGroup group(CrcThreadPool::Shared());
+
+    for (uint64_t first = 0; first < nCandidates; first += CRC_SOLVER_TASK_SIZE)
+    {
+        group.Run([&, first]()
+        {
+            uint64_t last = std::min<uint64_t>(first + CRC_SOLVER_TASK_SIZE, nCandidates);
+            uint64_t candidates[CRC_SOLVER_LANES];
+            uint64_t remainders[CRC_SOLVER_LANES];
+
+            for (uint64_t index = first; (index < last) && !done.load(std::memory_order_relaxed); index += CRC_SOLVER_LANES)
+            {
+                for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+                {
+                    uint64_t candidate = std::min<uint64_t>(index + lane, last - 1);
+                    candidates[lane] = oddOnly ? (2 * candidate + 1) : candidate;
+                }
+                CrcSolverModLanes(g, degreeG, candidates, searchWidth, remainders);
+
+                for (uint32_t lane = 0; (lane < CRC_SOLVER_LANES) && (index + lane < last); lane++)
+                {
+                    if (0 != remainders[lane])
+                    {
+                        continue;
+                    }
+
+                    uint64_t polynomial = candidates[lane];
+                    if (searchCofactor)
+                    {
+                        CrcGf2Polynomial cofactor(2, 0);
+                        cofactor[0] = candidates[lane];
+                        cofactor[searchWidth / 64] |= 1ULL << (searchWidth % 64);
+
+                        CrcGf2Polynomial quotient(1, 0);
+                        CrcGf2Mod(g, cofactor, &quotient);
+                        polynomial = quotient[0] & mask;
+                    }
+
+                    std::lock_guard<std::mutex> guard(lock);
+                    if (CrcSolverVerify(search, polynomial, solutions) && (solutions.size() >= maxResults))
+                    {
+                        done.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+    group.Wait();
+}
+
+// Every polynomial with x^0 term, CRC_SOLVER_LANES polynomials per loop
+static void CrcSolverBruteForce(const CrcSolverSearch &search, uint32_t maxResults, std::vector<CrcSolverResult> &solutions)
+{
+    uint8_t width = search.width;
+    uint64_t nCandidates = 1ULL << (width - 1);
+    std::mutex lock;
+    std::atomic<bool> done(false);
+    CrcTaskGroup group(CrcThreadPool::Shared());
+
+    if (width > CRC_SOLVER_MAX_SEARCH)
+    {
+        return;
+    }
+
+    for (uint64_t first = 0; first < nCandidates; first += CRC_SOLVER_TASK_SIZE)
+    {
+        group.Run([&, first]()
+        {
+            uint64_t last = std::min<uint64_t>(first + CRC_SOLVER_TASK_SIZE, nCandidates);
+            uint64_t polynomials[CRC_SOLVER_LANES];
+            uint64_t registers[CRC_SOLVER_LANES];
+            uint64_t powers[3][CRC_SOLVER_LANES];     // samples 0, 1 and the current one
+            bool consistent[CRC_SOLVER_LANES];
+            std::vector<uint64_t> values(search.nSamples * CRC_SOLVER_LANES);
+
+            for (uint64_t index = first; (index < last) && !done.load(std::memory_order_relaxed); index += CRC_SOLVER_LANES)
+            {
+                for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+                {
+                    polynomials[lane] = 2 * std::min<uint64_t>(index + lane, last - 1) + 1;
+                    consistent[lane] = true;
+                }
+
+                for (uint32_t i = 0; i < search.nSamples; i++)
+                {
+                    CrcSolverRegisterLanes(search.samples[i], polynomials, width, search.reflectedInput, registers, powers[std::min<uint32_t>(i, 2)]);
+                    for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+                    {
+                        values[lane * search.nSamples + i] = search.registers[i] ^ registers[lane];
+                    }
+
+                    // values[i] = init * x^(8*length_i) ^ xor, so (values[i] ^ values[0]) * (powers[1] ^ powers[0]) is
+                    // (values[1] ^ values[0]) * (powers[i] ^ powers[0]) for every solution
+                    if (i >= 2)
+                    {
+                        uint64_t a[CRC_SOLVER_LANES];
+                        uint64_t b[CRC_SOLVER_LANES];
+                        uint64_t c[CRC_SOLVER_LANES];
+                        uint64_t d[CRC_SOLVER_LANES];
+
+                        for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+                        {
+                            a[lane] = values[lane * search.nSamples + i] ^ values[lane * search.nSamples];
+                            b[lane] = powers[1][lane] ^ powers[0][lane];
+                            c[lane] = values[lane * search.nSamples + 1] ^ values[lane * search.nSamples];
+                            d[lane] = powers[std::min<uint32_t>(i, 2)][lane] ^ powers[0][lane];
+                        }
+                        CrcSolverMultiplyLanes(a, b, polynomials, width, a);
+                        CrcSolverMultiplyLanes(c, d, polynomials, width, c);
+                        for (uint32_t lane = 0; lane < CRC_SOLVER_LANES; lane++)
+                        {
+                            consistent[lane] = consistent[lane] && (a[lane] == c[lane]);
+                        }
+                    }
+                }
+
+                for (uint32_t lane = 0; (lane < CRC_SOLVER_LANES) && (index + lane < last); lane++)
+                {
+                    uint64_t initialValue;
+                    uint64_t xorValue;
+                    bool unique;
+
+                    if (consistent[lane] && CrcSolverInitialValue(polynomials[lane], width, search.samples, &values[lane * search.nSamples], search.nSamples, initialValue, xorValue, unique))
+                    {
+                        std::lock_guard<std::mutex> guard(lock);
+                        CrcSolverAddSolution(search, polynomials[lane], initialValue, xorValue, unique, solutions);
+                        if (solutions.size() >= maxResults)
+                        {
+                            done.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+        });
+    }
+    group.Wait();
+}
+
+static bool CrcSolverMatches(const CrcModelParameters &parameters, const CrcSolverSample samples[], uint32_t nSamples)
+{
+    for (uint32_t i = 0; i < nSamples; i++)
+    {
+        if (samples[i].crc != CalculateCRCBitwise<uint64_t>(parameters.polynomial, samples[i].crc_DataPtr, samples[i].crc_Length, parameters.initialValue,
+                                                           parameters.xorValue, parameters.reflectedOutput, parameters.reflectedInput, parameters.width))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Sample registers and GCD of the pair polynomials for one combination of reflections, flags bit 0 input, bit 1 output
+static void CrcSolverPrepare(uint8_t width, const CrcSolverSample samples[], uint32_t nSamples, uint32_t flags, CrcSolverSearch &search, CrcGf2Polynomial &g)
+{
+    search.width = width;
+    search.reflectedInput = (0 != (flags & 0x01));
+    search.reflectedOutput = (0 != (flags & 0x02));
+    search.samples = samples;
+    search.nSamples = nSamples;
+
+    // output reflection and xor are undone together with the xor value later
+    for (uint32_t i = 0; i < nSamples; i++)
+    {
+        uint64_t crc = samples[i].crc & CrcSolverMask(width);
+        search.registers.push_back(search.reflectedOutput ? CrcReflectValue(crc, width) : crc);
+    }
+
+    // first sample of every length is paired with the later ones of the same length
+    for (uint32_t i = 1; i < nSamples; i++)
+    {
+        for (uint32_t first = 0; first < i; first++)
+        {
+            if (samples[first].crc_Length == samples[i].crc_Length)
+            {
+                g = CrcGf2Gcd(g, CrcSolverPairPolynomial(samples[first], samples[i], search.registers[first], search.registers[i], width, search.reflectedInput));
+                break;
+            }
+        }
+    }
+}
+
+uint64_t CrcSolveCandidates(uint8_t width, const CrcSolverSample samples[], uint32_t nSamples)
+{
+    uint64_t nCandidates = 0;
+
+    if ((width < 3) || (width > 64) || (0 == nSamples))
+    {
+        return 0;
+    }
+
+    for (uint32_t flags = 0; flags < 4; flags++)
+    {
+        CrcSolverSearch search;
+        CrcGf2Polynomial g;
+
+        CrcSolverPrepare(width, samples, nSamples, flags, search, g);
+        nCandidates = std::max<uint64_t>(nCandidates, CrcSolverCandidates(width, g));
+    }
+
+    return nCandidates;
+}
+
+uint32_t CrcSolve(uint8_t width, const CrcSolverSample samples[], uint32_t nSamples, CrcSolverResult results[], uint32_t maxResults, uint64_t maxCandidates)
+{
+    std::vector<CrcSolverResult> solutions;
+
+    if ((width < 3) || (width > 64) || (0 == nSamples))
+    {
+        return 0;
+    }
+
+    for (uint32_t flags = 0; (flags < 4) && (solutions.size() < maxResults); flags++)
+    {
+        CrcSolverSearch search;
+        CrcGf2Polynomial g;
+
+        CrcSolverPrepare(width, samples, nSamples, flags, search, g);
+        if (CrcSolverCandidates(width, g) > maxCandidates)
+        {
+            continue;
+        }
+
+        if (CrcGf2Degree(g) >= 0)
+        {
+            CrcSolverDivisors(search, g, maxResults, solutions);
+        }
+        else
+        {
+            CrcSolverBruteForce(search, maxResults, solutions);
+        }
+    }
+
+    // catalogue model which gives the same CRCs, also for an initial value which is not unique
+    for (CrcSolverResult &solution : solutions)
+    {
+        for (uint32_t id = 0; id < CRC_MODEL_COUNT; id++)
+        {
+            const CrcModelParameters &catalogue = CrcGetModelParameters((CrcModelId)id);
+
+            if ((catalogue.width == solution.parameters.width) && (catalogue.polynomial == solution.parameters.polynomial) &&
+                (catalogue.reflectedInput == solution.parameters.reflectedInput) && (catalogue.reflectedOutput == solution.parameters.reflectedOutput) &&
+                CrcSolverMatches(catalogue, samples, nSamples))
+            {
+                solution.parameters = catalogue;
+                break;
+            }
+        }
+    }
+
+    std::sort(solutions.begin(), solutions.end(), [](const CrcSolverResult &a, const CrcSolverResult &b)
+    {
+        if (a.parameters.polynomial != b.parameters.polynomial)
+        {
+            return a.parameters.polynomial < b.parameters.polynomial;
+        }
+        return (a.parameters.reflectedInput + 2 * a.parameters.reflectedOutput) < (b.parameters.reflectedInput + 2 * b.parameters.reflectedOutput);
+    });
+
+    uint32_t nResults = (uint32_t)std::min<size_t>(solutions.size(), maxResults);
+    for (uint32_t i = 0; i < nResults; i++)
+    {
+        results[i] = solutions[i];
+    }
+    return nResults;
+}
@@ -0,0 +1,52 @@
+#ifndef CRC_SOLVER_H
+#define CRC_SOLVER_H
+
+#include <stdint.h>
+
+#include "crcRegistry.h"
+
+//Recovers CRC parameters (polynomial, initial value, xor value, reflection) of a given width from sample messages
+//with known CRCs.
+//
+//CRC register is linear, so for two messages of the same length the initial and xor value cancel:
+//    (m1 ^ m2)(x) * x^width + (crc1 ^ crc2)(x) = 0 mod P
+//P divides GCD of these polynomials over all pairs of the same length. With a few pairs the GCD is P itself, else
+//the divisors of width bits are searched. Initial and xor value are then solved as linear system over GF(2) from
+//messages of different lengths. Without two messages of the same length every polynomial is tried: the CRCs of
+//8 polynomials are calculated together in one loop and the polynomial space is split over the shared thread pool.
+//That search is practical up to about 24 bits, wider CRCs need at least two samples of the same length.
+//A single pair of the same length leaves a GCD of 8 * length + width bits, its divisors of width bits are searched
+//then, which is as slow. CrcSolveCandidates() tells the size of the search before, CrcSolve() skips reflections
+//with more than maxCandidates polynomials to try.
+//
+//Give a few more samples than needed, every solution is verified against all samples. With all samples of the
+//same length the initial value can not be separated from the xor value; a catalogue model which fits is reported
+//if there is one, else initial value 0. Polynomials with factor x+1 (e.g. 0x1021) leave one bit of the initial value
+//open for all messages, the xor value compensates it.
+
+// One captured message and its CRC
+struct CrcSolverSample
+{
+    const uint8_t *crc_DataPtr;
+    uint32_t crc_Length;
+    uint64_t crc;
+};
+
+struct CrcSolverResult
+{
+    CrcModelParameters parameters;  // name and alias of a catalogue model with the same parameters, else nullptr
+    bool uniqueInitialValue;        // false if other initial/xor value pairs give the same CRCs for the samples
+};
+
+// Search which takes a few seconds at most, about 2^24 polynomials
+#define CRC_SOLVER_SEARCH_LIMIT     (1ULL << 24)
+
+// Returns the largest number of polynomials CrcSolve() tries for one combination of reflections, 1 if the samples
+// determine the polynomial, 0 if no polynomial can be searched
+uint64_t CrcSolveCandidates(uint8_t width, const CrcSolverSample samples[], uint32_t nSamples);
+
+// Returns number of solutions written to results, at most maxResults. Searches are stopped after maxResults solutions,
+// reflection combinations with more than maxCandidates polynomials to try are skipped (UINT64_MAX for all).
+uint32_t CrcSolve(uint8_t width, const CrcSolverSample samples[], uint32_t nSamples, CrcSolverResult results[], uint32_t maxResults, uint64_t maxCandidates);
+
+#endif /* CRC_SOLVER_H */
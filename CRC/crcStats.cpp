@@ -0,0 +1,251 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "crcStats.h"
+
+static const char *const crcStatsKernelNames[CRC_STATS_KERNEL_COUNT] =
+{
+    "table", "reflected", "slicing8", "slicing16", "nibble", "bitwise", "clmul", "parallel", "batch", "segments"
+};
+
+static const char *const crcStatsModelNames[CRC_STATS_MODEL_COUNT - CRC_MODEL_COUNT] =
+{
+    "CalculateCRC8", "CalculateCRC16", "CalculateCRC32", "CalculateCRC64"
+};
+
+const char *CrcStatsModelName(uint32_t model)
+{
+    if (model < CRC_MODEL_COUNT)
+    {
+        return CrcGetModelParameters((CrcModelId)model).name;
+    }
+    return (model < CRC_STATS_MODEL_COUNT) ? crcStatsModelNames[model - CRC_MODEL_COUNT] : "unknown";
+}
+
+const char *CrcStatsKernelName(CrcStatsKernel kernel)
+{
+    return ((uint32_t)kernel < CRC_STATS_KERNEL_COUNT) ? crcStatsKernelNames[kernel] : "unknown";
+}
+
+#ifdef CRC_STATS
+
+thread_local uint32_t crcStatsDepth = 0;
+
+// Counters of one model and kernel in one thread. Only the owning thread writes them, a snapshot reads them at any time.
+struct alignas(64) CrcStatsCounters
+{
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> bytes;
+    std::atomic<uint64_t> nanoseconds;
+    std::atomic<uint64_t> sizes[CRC_STATS_BUCKETS];
+    std::atomic<uint64_t> latencies[CRC_STATS_BUCKETS];
+};
+
+// Slots of one thread, created on the first counted call. Kept when the thread ends and reused by the next new thread,
+// so the counts stay in the totals and a snapshot never reads freed memory.
+struct CrcStatsThread
+{
+    std::atomic<CrcStatsCounters *> counters[CRC_STATS_MODEL_COUNT][CRC_STATS_KERNEL_COUNT];
+    bool inUse;
+};
+
+static std::mutex crcStatsLock;
+static std::vector<CrcStatsThread *> crcStatsThreads;
+static std::vector<CrcStatsRecord> crcStatsBaseline;   // totals at the last CrcStatsReset()
+
+class CrcStatsThreadSlot
+{
+public:
+    CrcStatsThreadSlot() : thread(nullptr)
+    {
+        std::lock_guard<std::mutex> guard(crcStatsLock);
+
+        for (CrcStatsThread *unused : crcStatsThreads)
+        {
+            if (!unused->inUse)
+            {
+                thread = unused;
+                break;
+            }
+        }
+        if (nullptr == thread)
+        {
+            thread = new CrcStatsThread();
+            crcStatsThreads.push_back(thread);
+        }
+        thread->inUse = true;
+    }
+
+    ~CrcStatsThreadSlot()
+    {
+        std::lock_guard<std::mutex> guard(crcStatsLock);
+        thread->inUse = false;
+    }
+
+    CrcStatsThread *thread;
+};
+
+static thread_local CrcStatsThreadSlot crcStatsThreadSlot;
+
+static uint32_t CrcStatsBucket(uint64_t value)
+{
+    if (0 == value)
+    {
+        return 0;
+    }
+    uint32_t bucket = 64 - __builtin_clzll(value);
+    return (bucket < CRC_STATS_BUCKETS) ? bucket : (CRC_STATS_BUCKETS - 1);
+}
+
+// Single writer, so load and store instead of a locked read-modify-write
+static void CrcStatsIncrement(std::atomic<uint64_t> &counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void CrcStatsAdd(uint32_t model, CrcStatsKernel kernel, uint64_t crc_Length, uint64_t nanoseconds)
+{
+    if ((model >= CRC_STATS_MODEL_COUNT) || ((uint32_t)kernel >= CRC_STATS_KERNEL_COUNT))
+    {
+        return;
+    }
+
+    std::atomic<CrcStatsCounters *> &slot = crcStatsThreadSlot.thread->counters[model][kernel];
+    CrcStatsCounters *counters = slot.load(std::memory_order_relaxed);
+    if (nullptr == counters)
+    {
+        counters = new CrcStatsCounters();
+        slot.store(counters, std::memory_order_release);
+    }
+
+    CrcStatsIncrement(counters->calls, 1);
+    CrcStatsIncrement(counters->bytes, crc_Length);
+    CrcStatsIncrement(counters->nanoseconds, nanoseconds);
+    CrcStatsIncrement(counters->sizes[CrcStatsBucket(crc_Length)], 1);
+    CrcStatsIncrement(counters->latencies[CrcStatsBucket(nanoseconds)], 1);
+}
+
+// Sum of all threads for every model and kernel, crcStatsLock has to be held
+static std::vector<CrcStatsRecord> CrcStatsTotals()
+{
+    std::vector<CrcStatsRecord> totals(CRC_STATS_MODEL_COUNT * CRC_STATS_KERNEL_COUNT, CrcStatsRecord());
+
+    for (uint32_t model = 0; model < CRC_STATS_MODEL_COUNT; model++)
+    {
+        for (uint32_t kernel = 0; kernel < CRC_STATS_KERNEL_COUNT; kernel++)
+        {
+            CrcStatsRecord &total = totals[model * CRC_STATS_KERNEL_COUNT + kernel];
+            total.model = model;
+            total.kernel = (CrcStatsKernel)kernel;
+
+            for (CrcStatsThread *thread : crcStatsThreads)
+            {
+                const CrcStatsCounters *counters = thread->counters[model][kernel].load(std::memory_order_acquire);
+                if (nullptr == counters)
+                {
+                    continue;
+                }
+
+                total.calls += counters->calls.load(std::memory_order_relaxed);
+                total.bytes += counters->bytes.load(std::memory_order_relaxed);
+                total.nanoseconds += counters->nanoseconds.load(std::memory_order_relaxed);
+                for (uint32_t bucket = 0; bucket < CRC_STATS_BUCKETS; bucket++)
+                {
+                    total.sizes[bucket] += counters->sizes[bucket].load(std::memory_order_relaxed);
+                    total.latencies[bucket] += counters->latencies[bucket].load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    return totals;
+}
+
+uint32_t CrcStatsSnapshot(CrcStatsRecord records[], uint32_t maxRecords)
+{
+    std::lock_guard<std::mutex> guard(crcStatsLock);
+    std::vector<CrcStatsRecord> totals = CrcStatsTotals();
+    uint32_t nRecords = 0;
+
+    for (uint32_t i = 0; (i < totals.size()) && (nRecords < maxRecords); i++)
+    {
+        CrcStatsRecord record = totals[i];
+
+        if (!crcStatsBaseline.empty())
+        {
+            const CrcStatsRecord &baseline = crcStatsBaseline[i];
+            record.calls -= baseline.calls;
+            record.bytes -= baseline.bytes;
+            record.nanoseconds -= baseline.nanoseconds;
+            for (uint32_t bucket = 0; bucket < CRC_STATS_BUCKETS; bucket++)
+            {
+                record.sizes[bucket] -= baseline.sizes[bucket];
+                record.latencies[bucket] -= baseline.latencies[bucket];
+            }
+        }
+
+        if (0 != record.calls)
+        {
+            records[nRecords++] = record;
+        }
+    }
+
+    return nRecords;
+}
+
+// Counters are written without lock by their threads, so they are not cleared but remembered as baseline
+void CrcStatsReset()
+{
+    std::lock_guard<std::mutex> guard(crcStatsLock);
+    crcStatsBaseline = CrcStatsTotals();
+}
+
+#else
+
+uint32_t CrcStatsSnapshot(CrcStatsRecord records[], uint32_t maxRecords)
+{
+    (void)records;
+    (void)maxRecords;
+    return 0;
+}
+
+void CrcStatsReset()
+{
+}
+
+#endif /* CRC_STATS */
+
+static void CrcStatsDumpHistogram(FILE *file, const char *name, const uint64_t histogram[CRC_STATS_BUCKETS])
+{
+    const char *separator = "";
+
+    fprintf(file, " %s=", name);
+    for (uint32_t bucket = 0; bucket < CRC_STATS_BUCKETS; bucket++)
+    {
+        if (0 != histogram[bucket])
+        {
+            fprintf(file, "%s%u:%llu", separator, bucket, (unsigned long long)histogram[bucket]);
+            separator = ",";
+        }
+    }
+}
+
+void CrcStatsDump(FILE *file)
+{
+    std::vector<CrcStatsRecord> records(CRC_STATS_MODEL_COUNT * CRC_STATS_KERNEL_COUNT);
+    uint32_t nRecords = CrcStatsSnapshot(records.data(), (uint32_t)records.size());
+
+    for (uint32_t i = 0; i < nRecords; i++)
+    {
+        const CrcStatsRecord &record = records[i];
+
+        fprintf(file, "crcstats model=%s kernel=%s calls=%llu bytes=%llu ns=%llu", CrcStatsModelName(record.model), CrcStatsKernelName(record.kernel),
+                (unsigned long long)record.calls, (unsigned long long)record.bytes, (unsigned long long)record.nanoseconds);
+        CrcStatsDumpHistogram(file, "sizes", record.sizes);
+        CrcStatsDumpHistogram(file, "latencies", record.latencies);
+        fprintf(file, "\n");
+    }
+}
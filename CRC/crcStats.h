@@ -0,0 +1,146 @@
+#ifndef CRC_STATS_H
+#define CRC_STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#ifdef CRC_STATS
+#include <chrono>
+#endif
+
+#include "crcKernel.h"
+#include "crcRegistry.h"
+
+//Optional instrumentation of the CRC entry points: calls, bytes, a histogram of message sizes and a histogram of
+//latencies per model and kernel. Build all sources with -DCRC_STATS to enable it, without the define
+//CRC_STATS_SCOPE() is empty and the snapshot is always empty.
+//
+//Every thread counts into its own cache line aligned slots, so the hot path has no atomic read-modify-write and no
+//shared cache line; CrcStatsSnapshot() adds the slots of all threads. Only the outermost instrumented call of a thread
+//is counted (e.g. CalculateCRC32Clmul() and not the CalculateCRC32() it calls for the tail), chunks of a parallel CRC
+//are counted by the worker threads as well. A counted call costs two steady_clock reads.
+//
+//Histogram bucket b counts the values in [2^(b-1), 2^b), bucket 0 is the value 0 and the last bucket everything above.
+
+#define CRC_STATS_BUCKETS   32U
+
+enum CrcStatsKernel
+{
+    CRC_STATS_TABLE,
+    CRC_STATS_REFLECTED,
+    CRC_STATS_SLICING8,
+    CRC_STATS_SLICING16,
+    CRC_STATS_NIBBLE,
+    CRC_STATS_BITWISE,
+    CRC_STATS_CLMUL,
+    CRC_STATS_PARALLEL,
+    CRC_STATS_BATCH,
+    CRC_STATS_SEGMENTS,
+
+    CRC_STATS_KERNEL_COUNT
+};
+
+// Models are CrcModelId for the AUTOSAR functions and the catalogue, these for the CalculateCRCxx functions
+enum CrcStatsModel
+{
+    CRC_STATS_MODEL_CRC8 = CRC_MODEL_COUNT,
+    CRC_STATS_MODEL_CRC16,
+    CRC_STATS_MODEL_CRC32,
+    CRC_STATS_MODEL_CRC64,
+
+    CRC_STATS_MODEL_COUNT
+};
+
+struct CrcStatsRecord
+{
+    uint32_t model;                             // CrcModelId or CrcStatsModel
+    CrcStatsKernel kernel;
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t nanoseconds;
+    uint64_t sizes[CRC_STATS_BUCKETS];          // calls by crc_Length in bytes
+    uint64_t latencies[CRC_STATS_BUCKETS];      // calls by duration in ns
+};
+
+// Model and kernel pairs with at least one call since the last CrcStatsReset(), returns the number of records
+uint32_t CrcStatsSnapshot(CrcStatsRecord records[], uint32_t maxRecords);
+
+// Following snapshots count from now on
+void CrcStatsReset();
+
+// One line per record:
+//    crcstats model=CRC-32/ISO-HDLC kernel=clmul calls=3 bytes=3081 ns=2304 sizes=11:3 latencies=9:2,10:1
+// sizes and latencies list bucket:count for the buckets which are not 0
+void CrcStatsDump(FILE *file);
+
+const char *CrcStatsModelName(uint32_t model);
+const char *CrcStatsKernelName(CrcStatsKernel kernel);
+
+#ifdef CRC_STATS
+
+extern thread_local uint32_t crcStatsDepth;
+
+void CrcStatsAdd(uint32_t model, CrcStatsKernel kernel, uint64_t crc_Length, uint64_t nanoseconds);
+
+// Bytes of a batch or segment call, counted as one call
+inline uint64_t CrcStatsLength(const uint32_t crc_Lengths[], uint32_t nMessages)
+{
+    uint64_t length = 0;
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        length += crc_Lengths[i];
+    }
+    return length;
+}
+
+inline uint64_t CrcStatsLength(const CrcSegment crc_Segments[], uint32_t nSegments)
+{
+    uint64_t length = 0;
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        length += crc_Segments[i].crc_Length;
+    }
+    return length;
+}
+
+// Counts the enclosing function call if it is the outermost instrumented one of the thread
+class CrcStatsScope
+{
+public:
+    CrcStatsScope(uint32_t model, CrcStatsKernel kernel, uint64_t crc_Length) : model(model), kernel(kernel), length(crc_Length), outermost(0 == crcStatsDepth++)
+    {
+        if (outermost)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~CrcStatsScope()
+    {
+        crcStatsDepth--;
+        if (outermost)
+        {
+            std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start;
+            CrcStatsAdd(model, kernel, length, (uint64_t)duration.count());
+        }
+    }
+
+    CrcStatsScope(const CrcStatsScope &) = delete;
+    CrcStatsScope &operator=(const CrcStatsScope &) = delete;
+
+private:
+    uint32_t model;
+    CrcStatsKernel kernel;
+    uint64_t length;
+    bool outermost;
+    std::chrono::steady_clock::time_point start;
+};
+
+#define CRC_STATS_SCOPE(model, kernel, crc_Length)  CrcStatsScope crcStatsScope((model), (kernel), (crc_Length))
+
+#else
+
+#define CRC_STATS_SCOPE(model, kernel, crc_Length)
+
+#endif /* CRC_STATS */
+
+#endif /* CRC_STATS_H */
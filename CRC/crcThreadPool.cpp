@@ -0,0 +1,167 @@
+#include <stdint.h>
+
+#include "crcThreadPool.h"
+
+CrcThreadPool::CrcThreadPool(uint32_t nWorkers) : pendingTasks(0), nextWorker(0), stop(false)
+{
+    if (0 == nWorkers)
+    {
+        nWorkers = 1;
+    }
+
+    for (uint32_t i = 0; i < nWorkers; i++)
+    {
+        workers.emplace_back(new Worker());
+    }
+    for (uint32_t i = 0; i < nWorkers; i++)
+    {
+        threads.emplace_back(&CrcThreadPool::WorkerLoop, this, i);
+    }
+}
+
+CrcThreadPool::~CrcThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stop = true;
+    }
+    wakeUp.notify_all();
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+uint32_t CrcThreadPool::Workers() const
+{
+    return (uint32_t)workers.size();
+}
+
+void CrcThreadPool::Submit(std::function<void()> task)
+{
+    Worker &worker = *workers[nextWorker++ % workers.size()];
+
+    {
+        std::lock_guard<std::mutex> guard(worker.lock);
+        worker.tasks.push_back(std::move(task));
+    }
+
+    // counter is changed under sleepLock, a worker going to sleep can not miss it
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        pendingTasks++;
+    }
+    wakeUp.notify_one();
+}
+
+// Own queue is used from the back (last submitted, still in cache), other queues are stolen from the front
+bool CrcThreadPool::PopTask(uint32_t index, std::function<void()> &task)
+{
+    uint32_t nWorkers = (uint32_t)workers.size();
+
+    for (uint32_t i = 0; i < nWorkers; i++)
+    {
+        Worker &worker = *workers[(index + i) % nWorkers];
+        std::lock_guard<std::mutex> guard(worker.lock);
+
+        if (!worker.tasks.empty())
+        {
+            if (0 == i)
+            {
+                task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+            }
+            else
+            {
+                task = std::move(worker.tasks.front());
+                worker.tasks.pop_front();
+            }
+            pendingTasks--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool CrcThreadPool::RunPendingTask()
+{
+    std::function<void()> task;
+
+    if (PopTask(nextWorker % workers.size(), task))
+    {
+        task();
+        return true;
+    }
+    return false;
+}
+
+void CrcThreadPool::WorkerLoop(uint32_t index)
+{
+    std::function<void()> task;
+
+    for (;;)
+    {
+        if (PopTask(index, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepLock);
+        wakeUp.wait(lock, [this] { return stop || (0 != pendingTasks); });
+        if (stop)
+        {
+            return;
+        }
+    }
+}
+
+CrcThreadPool &CrcThreadPool::Shared()
+{
+    static CrcThreadPool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 1);
+    return pool;
+}
+
+CrcTaskGroup::CrcTaskGroup(CrcThreadPool &pool) : pool(pool), remainingTasks(0)
+{
+}
+
+CrcTaskGroup::~CrcTaskGroup()
+{
+    Wait();
+}
+
+void CrcTaskGroup::Run(std::function<void()> task)
+{
+    remainingTasks++;
+    pool.Submit([this, task]()
+    {
+        task();
+
+        // notified under the lock, Wait() takes it before it returns and the group is destroyed
+        std::lock_guard<std::mutex> guard(doneLock);
+        if (0 == --remainingTasks)
+        {
+            done.notify_all();
+        }
+    });
+}
+
+void CrcTaskGroup::Wait()
+{
+    while (0 != remainingTasks)
+    {
+        if (!pool.RunPendingTask())
+        {
+            break;
+        }
+    }
+
+    // remaining tasks of the group run on other threads, the lock is also taken when they are done already as the
+    // last one may still notify
+    std::unique_lock<std::mutex> lock(doneLock);
+    done.wait(lock, [this] { return 0 == remainingTasks; });
+}
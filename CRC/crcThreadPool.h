@@ -0,0 +1,74 @@
+#ifndef CRC_THREAD_POOL_H
+#define CRC_THREAD_POOL_H
+
+#include <stdint.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//Work stealing thread pool for parallel CRC calculation. Every worker has its own task queue, idle workers take
+//tasks from the other queues. Workers are started once and reused, so a parallel CRC of a medium size buffer
+//does not pay for thread creation.
+
+class CrcThreadPool
+{
+public:
+    explicit CrcThreadPool(uint32_t nWorkers);
+    ~CrcThreadPool();
+
+    CrcThreadPool(const CrcThreadPool &) = delete;
+    CrcThreadPool &operator=(const CrcThreadPool &) = delete;
+
+    uint32_t Workers() const;
+
+    void Submit(std::function<void()> task);
+
+    // Runs one queued task in the calling thread, returns false if all queues are empty
+    bool RunPendingTask();
+
+    // Pool shared by all parallel CRC functions, one worker less than hardware threads as the caller helps
+    static CrcThreadPool &Shared();
+
+private:
+    struct Worker
+    {
+        std::mutex lock;
+        std::deque<std::function<void()> > tasks;
+    };
+
+    bool PopTask(uint32_t index, std::function<void()> &task);
+    void WorkerLoop(uint32_t index);
+
+    std::vector<std::unique_ptr<Worker> > workers;
+    std::vector<std::thread> threads;
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+    std::atomic<uint32_t> pendingTasks;
+    std::atomic<uint32_t> nextWorker;
+    bool stop;
+};
+
+// Set of tasks the caller waits for, waiting thread runs queued tasks and blocks once all queues are empty until
+// the last task of the group is done
+class CrcTaskGroup
+{
+public:
+    explicit CrcTaskGroup(CrcThreadPool &pool);
+    ~CrcTaskGroup();
+
+    void Run(std::function<void()> task);
+    void Wait();
+
+private:
+    CrcThreadPool &pool;
+    std::atomic<uint32_t> remainingTasks;
+    std::mutex doneLock;
+    std::condition_variable done;
+};
+
+#endif /* CRC_THREAD_POOL_H */
@@ -1,24 +1,116 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <vector>
+#if defined(__linux__)
+#include <thread>
+#include <unistd.h>
+#endif
+
+#include "crcHamming.h"
+#include "crcModel.h"
+#include "crcRegistry.h"
+#include "crcService.h"
+#include "crcSolver.h"
+#include "crcStats.h"
 
 
 extern uint8_t CalculateCRC8(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
 extern uint16_t CalculateCRC16(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
 extern uint32_t CalculateCRC32(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Reflected(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput);
+
+extern uint64_t CalculateCRC64(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Reflected(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput);
+extern uint8_t CalculateCRC8Nibble(uint8_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Nibble(uint16_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Nibble(uint32_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Nibble(uint64_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint8_t CalculateCRC8Bitwise(uint8_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Bitwise(uint16_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Bitwise(uint32_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Bitwise(uint64_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Slicing8(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Slicing16(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Slicing8(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Slicing16(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Slicing8(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Slicing16(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint8_t CalculateCRC8Reflected(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput);
+extern uint16_t CalculateCRC16Reflected(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput);
+extern uint16_t CalculateCRC16ReflectedSlicing8(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput);
+extern uint16_t CalculateCRC16ReflectedSlicing16(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput);
+extern uint32_t CalculateCRC32ReflectedSlicing8(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput);
+extern uint32_t CalculateCRC32ReflectedSlicing16(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput);
+extern uint64_t CalculateCRC64ReflectedSlicing8(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput);
+extern uint64_t CalculateCRC64ReflectedSlicing16(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput);
+
+extern uint8_t CalculateCRC8Clmul(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Clmul(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Clmul(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Clmul(uint64_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+
+extern uint16_t CalculateCRC16Parallel(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Parallel(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+
+extern void CalculateCRC8Batch(uint8_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint8_t crcResults[]);
+extern void CalculateCRC16Batch(uint16_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint16_t crcResults[]);
+extern void CalculateCRC32Batch(uint32_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint32_t crcResults[]);
+
+extern uint8_t CalculateCRC8Segments(uint8_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Segments(uint16_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Segments(uint32_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
 
 extern void Crc8TableGenerator(uint8_t polynomial, uint8_t crcTable[256]);
 extern void Crc16TableGenerator(uint16_t polynomial, uint16_t crcTable[256]);
 extern void Crc32TableGenerator(uint32_t polynomial, uint32_t crcTable[256]);
+extern void Crc64TableGenerator(uint64_t polynomial, uint64_t crcTable[256]);
+extern void Crc8NibbleTableGenerator(uint8_t polynomial, uint8_t crcTable[16]);
+extern void Crc16NibbleTableGenerator(uint16_t polynomial, uint16_t crcTable[16]);
+extern void Crc32NibbleTableGenerator(uint32_t polynomial, uint32_t crcTable[16]);
+extern void Crc64NibbleTableGenerator(uint64_t polynomial, uint64_t crcTable[16]);
+extern void Crc8ReflectedTableGenerator(uint8_t polynomial, uint8_t crcTable[256]);
+extern void Crc16ReflectedTableGenerator(uint16_t polynomial, uint16_t crcTable[256]);
+extern void Crc32ReflectedTableGenerator(uint32_t polynomial, uint32_t crcTable[256]);
+extern void Crc64ReflectedTableGenerator(uint64_t polynomial, uint64_t crcTable[256]);
+extern void Crc16SlicingTableGenerator(uint16_t polynomial, uint16_t crcTable[][256], uint8_t nSlices);
+extern void Crc32SlicingTableGenerator(uint32_t polynomial, uint32_t crcTable[][256], uint8_t nSlices);
+extern void Crc64SlicingTableGenerator(uint64_t polynomial, uint64_t crcTable[][256], uint8_t nSlices);
+extern void Crc16ReflectedSlicingTableGenerator(uint16_t polynomial, uint16_t crcTable[][256], uint8_t nSlices);
+extern void Crc32ReflectedSlicingTableGenerator(uint32_t polynomial, uint32_t crcTable[][256], uint8_t nSlices);
+extern void Crc64ReflectedSlicingTableGenerator(uint64_t polynomial, uint64_t crcTable[][256], uint8_t nSlices);
+extern uint8_t Crc_CalculateCRC8(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_StartValue8, bool crc_IsFirstCall);
+extern uint8_t Crc_CalculateCRC8H2F(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_StartValue8H2F, bool crc_IsFirstCall);
+extern uint16_t Crc_CalculateCRC16(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_StartValue16, bool crc_IsFirstCall);
+extern uint32_t Crc_CalculateCRC32(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_StartValue32, bool crc_IsFirstCall);
+extern uint32_t Crc_CalculateCRC32P4(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_StartValue32, bool crc_IsFirstCall);
+extern uint64_t Crc_CalculateCRC64(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_StartValue64, bool crc_IsFirstCall);
+
+extern void CrcClmulConstantsGenerator(uint64_t polynomial, uint8_t width, uint64_t clmulConstants[16]);
 
 extern void TestCRC8(uint8_t calculatedCrc, uint8_t expectedCrc);
 extern void TestCRC16(uint16_t calculatedCrc, uint16_t expectedCrc);
 extern void TestCRC32(uint32_t calculatedCrc, uint32_t expectedCrc);
+extern void TestCRC64(uint64_t calculatedCrc, uint64_t expectedCrc);
 
 int main()
 {
     uint8_t crcTable8bit[256];
     uint16_t crcTable16bit[256];
     uint32_t crcTable32bit[256];
+    uint16_t crcSlicingTable16bit[16][256];
+    uint32_t crcSlicingTable32bit[16][256];
+    uint32_t crcReflectedTable32bit[256];
+    uint64_t crcTable64bit[256];
+    uint64_t crcReflectedTable64bit[256];
+    uint64_t crcSlicingTable64bit[16][256];
+    uint32_t crcReflectedSlicingTable32bit[16][256];
+    uint64_t crcReflectedSlicingTable64bit[16][256];
+    uint64_t crcClmulConstants[16];
+    uint8_t crcNibbleTable8bit[16];
+    uint16_t crcNibbleTable16bit[16];
+    uint32_t crcNibbleTable32bit[16];
+    uint64_t crcNibbleTable64bit[16];
 
     uint8_t message1[] = { 0x00, 0x00, 0x00, 0x00 };
     uint8_t message2[] = { 0xF2, 0x01, 0x83 };
@@ -27,6 +119,12 @@ int main()
     uint8_t message5[] = { 0x33, 0x22, 0x55, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0XFF };
     uint8_t message6[] = { 0x92, 0x6B, 0x55 };
     uint8_t message7[] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    uint8_t longMessage[1027];
+
+    for (uint32_t i = 0U; i < sizeof(longMessage); i++)
+    {
+        longMessage[i] = (uint8_t)(i * 31U + 7U);
+    }
 
     uint8_t polynominal8bit;
     uint8_t initValue;
@@ -60,6 +158,14 @@ int main()
     TestCRC8(CalculateCRC8(crcTable8bit, message6, sizeof(message6), initValue, xorValue, false, false), 0x33);
     TestCRC8(CalculateCRC8(crcTable8bit, message7, sizeof(message7), initValue, xorValue, false, false), 0x6C);
 
+    //CRC8H2F carry-less multiply folding against the byte loop
+    CrcClmulConstantsGenerator(polynominal8bit, 8, crcClmulConstants);
+
+    TestCRC8(CalculateCRC8Clmul(crcTable8bit, crcClmulConstants, longMessage, sizeof(longMessage), initValue, xorValue, false, false),
+             CalculateCRC8(crcTable8bit, longMessage, sizeof(longMessage), initValue, xorValue, false, false));
+    TestCRC8(CalculateCRC8Clmul(crcTable8bit, crcClmulConstants, longMessage, 200, initValue, xorValue, false, false),
+             CalculateCRC8(crcTable8bit, longMessage, 200, initValue, xorValue, false, false));
+
     //CCITT-FALSE CRC16 Specification of CRC Routines page 23
     uint16_t polynominal16bit = 0x1021;
     uint16_t initValue16bit = 0xFFFF;
@@ -74,6 +180,25 @@ int main()
     TestCRC16(CalculateCRC16(crcTable16bit, message6, sizeof(message6), initValue16bit, xorValue16bit, false, false), 0x0745);
     TestCRC16(CalculateCRC16(crcTable16bit, message7, sizeof(message7), initValue16bit, xorValue16bit, false, false), 0x1D0F);
 
+    //CCITT-FALSE CRC16 slicing-by-8 and slicing-by-16 against the byte loop
+    Crc16SlicingTableGenerator(polynominal16bit, crcSlicingTable16bit, 16);
+
+    TestCRC16(CalculateCRC16Slicing8(crcSlicingTable16bit, message5, sizeof(message5), initValue16bit, xorValue16bit, false, false), 0xF53F);
+    TestCRC16(CalculateCRC16Slicing8(crcSlicingTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false),
+              CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false));
+    TestCRC16(CalculateCRC16Slicing16(crcSlicingTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false),
+              CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false));
+
+    //CCITT-FALSE CRC16 carry-less multiply folding against the byte loop, also reflected with non symmetric initial value
+    CrcClmulConstantsGenerator(polynominal16bit, 16, crcClmulConstants);
+
+    TestCRC16(CalculateCRC16Clmul(crcTable16bit, crcClmulConstants, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false),
+              CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false));
+    TestCRC16(CalculateCRC16Clmul(crcTable16bit, crcClmulConstants, longMessage, 200, initValue16bit, xorValue16bit, false, false),
+              CalculateCRC16(crcTable16bit, longMessage, 200, initValue16bit, xorValue16bit, false, false));
+    TestCRC16(CalculateCRC16Clmul(crcTable16bit, crcClmulConstants, longMessage, sizeof(longMessage), 0x1234, 0x00FF, true, true),
+              CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), 0x1234, 0x00FF, true, true));
+
     //Ethernet CRC Calculation - CRC32
     uint32_t polynominal32bit = 0x04C11DB7;
     uint32_t initValue32bit = 0xFFFFFFFF;
@@ -88,5 +213,583 @@ int main()
     TestCRC32(CalculateCRC32(crcTable32bit, message6, sizeof(message6), initValue32bit, xorValue32bit, true, true), 0x9CDEA29B);
     TestCRC32(CalculateCRC32(crcTable32bit, message7, sizeof(message7), initValue32bit, xorValue32bit, true, true), 0xFFFFFFFF);
 
+    //Ethernet CRC32 with reflected table
+    Crc32ReflectedTableGenerator(polynominal32bit, crcReflectedTable32bit);
+
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message1, sizeof(message1), initValue32bit, xorValue32bit, true), 0x2144DF1C);
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message2, sizeof(message2), initValue32bit, xorValue32bit, true), 0x24AB9D77);
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message3, sizeof(message3), initValue32bit, xorValue32bit, true), 0xB6C9B287);
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message4, sizeof(message4), initValue32bit, xorValue32bit, true), 0x32A06212);
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true), 0xB0AE863D);
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message6, sizeof(message6), initValue32bit, xorValue32bit, true), 0x9CDEA29B);
+    TestCRC32(CalculateCRC32Reflected(crcReflectedTable32bit, message7, sizeof(message7), initValue32bit, xorValue32bit, true), 0xFFFFFFFF);
+
+    //Ethernet CRC32 carry-less multiply folding against the byte loop
+    CrcClmulConstantsGenerator(polynominal32bit, 32, crcClmulConstants);
+
+    TestCRC32(CalculateCRC32Clmul(crcTable32bit, crcClmulConstants, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32Clmul(crcTable32bit, crcClmulConstants, longMessage, 200, initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, longMessage, 200, initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32Clmul(crcTable32bit, crcClmulConstants, longMessage, sizeof(longMessage), 0x12345678, 0, false, false),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0, false, false));
+
+    //Ethernet CRC32 slicing-by-8 and slicing-by-16 against the byte loop
+    Crc32SlicingTableGenerator(polynominal32bit, crcSlicingTable32bit, 16);
+
+    TestCRC32(CalculateCRC32Slicing8(crcSlicingTable32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true, true), 0xB0AE863D);
+    TestCRC32(CalculateCRC32Slicing8(crcSlicingTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32Slicing16(crcSlicingTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+
+    //Ethernet CRC32 slicing with reflected tables, register shifted right
+    Crc32ReflectedSlicingTableGenerator(polynominal32bit, crcReflectedSlicingTable32bit, 16);
+
+    TestCRC32(CalculateCRC32ReflectedSlicing8(crcReflectedSlicingTable32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true), 0xB0AE863D);
+    TestCRC32(CalculateCRC32ReflectedSlicing8(crcReflectedSlicingTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32ReflectedSlicing16(crcReflectedSlicingTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32ReflectedSlicing16(crcReflectedSlicingTable32bit, longMessage, 1000, 0x12345678, 0, false),
+              CalculateCRC32(crcTable32bit, longMessage, 1000, 0x12345678, 0, false, true));
+
+    //CRC32P4 (E2E Profile 4) Specification of CRC Routines
+    uint32_t polynominal32bitP4 = 0xF4ACFB13;
+    uint32_t crcTable32bitP4[256];
+    Crc32TableGenerator(polynominal32bitP4, crcTable32bitP4);
+
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message1, sizeof(message1), initValue32bit, xorValue32bit, true, true), 0x6FB32240);
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message2, sizeof(message2), initValue32bit, xorValue32bit, true, true), 0x4F721A25);
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message3, sizeof(message3), initValue32bit, xorValue32bit, true, true), 0x20662DF8);
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message4, sizeof(message4), initValue32bit, xorValue32bit, true, true), 0x9BD7996E);
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message5, sizeof(message5), initValue32bit, xorValue32bit, true, true), 0xA65A343D);
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message6, sizeof(message6), initValue32bit, xorValue32bit, true, true), 0xEE688A78);
+    TestCRC32(CalculateCRC32(crcTable32bitP4, message7, sizeof(message7), initValue32bit, xorValue32bit, true, true), 0xFFFFFFFF);
+
+    CrcClmulConstantsGenerator(polynominal32bitP4, 32, crcClmulConstants);
+    TestCRC32(CalculateCRC32Clmul(crcTable32bitP4, crcClmulConstants, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bitP4, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+
+    //CRC64 (ECMA-182)  Specification of CRC Routines
+    uint64_t polynominal64bit = 0x42F0E1EBA9EA3693;
+    uint64_t initValue64bit = 0xFFFFFFFFFFFFFFFF;
+    uint64_t xorValue64bit = 0xFFFFFFFFFFFFFFFF;
+    Crc64TableGenerator(polynominal64bit, crcTable64bit);
+
+    TestCRC64(CalculateCRC64(crcTable64bit, message1, sizeof(message1), initValue64bit, xorValue64bit, true, true), 0xF4A586351E1B9F4B);
+    TestCRC64(CalculateCRC64(crcTable64bit, message2, sizeof(message2), initValue64bit, xorValue64bit, true, true), 0x319C27668164F1C6);
+    TestCRC64(CalculateCRC64(crcTable64bit, message3, sizeof(message3), initValue64bit, xorValue64bit, true, true), 0x54C5D0F7667C1575);
+    TestCRC64(CalculateCRC64(crcTable64bit, message4, sizeof(message4), initValue64bit, xorValue64bit, true, true), 0xA63822BE7E0704E6);
+    TestCRC64(CalculateCRC64(crcTable64bit, message5, sizeof(message5), initValue64bit, xorValue64bit, true, true), 0x701ECEB219A8E5D5);
+    TestCRC64(CalculateCRC64(crcTable64bit, message6, sizeof(message6), initValue64bit, xorValue64bit, true, true), 0x5FAA96A9B59F3E4E);
+    TestCRC64(CalculateCRC64(crcTable64bit, message7, sizeof(message7), initValue64bit, xorValue64bit, true, true), 0xFFFFFFFF00000000);
+
+    //CRC64 with reflected table
+    Crc64ReflectedTableGenerator(polynominal64bit, crcReflectedTable64bit);
+
+    TestCRC64(CalculateCRC64Reflected(crcReflectedTable64bit, message5, sizeof(message5), initValue64bit, xorValue64bit, true), 0x701ECEB219A8E5D5);
+    TestCRC64(CalculateCRC64Reflected(crcReflectedTable64bit, message7, sizeof(message7), initValue64bit, xorValue64bit, true), 0xFFFFFFFF00000000);
+    TestCRC64(CalculateCRC64Reflected(crcReflectedTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true));
+
+    //CRC64 slicing-by-8 and slicing-by-16 against the byte loop
+    Crc64SlicingTableGenerator(polynominal64bit, crcSlicingTable64bit, 16);
+
+    TestCRC64(CalculateCRC64Slicing8(crcSlicingTable64bit, message5, sizeof(message5), initValue64bit, xorValue64bit, true, true), 0x701ECEB219A8E5D5);
+    TestCRC64(CalculateCRC64Slicing8(crcSlicingTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true));
+    TestCRC64(CalculateCRC64Slicing16(crcSlicingTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, false, false),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, false, false));
+
+    //CRC64 slicing with reflected tables
+    Crc64ReflectedSlicingTableGenerator(polynominal64bit, crcReflectedSlicingTable64bit, 16);
+
+    TestCRC64(CalculateCRC64ReflectedSlicing8(crcReflectedSlicingTable64bit, message5, sizeof(message5), initValue64bit, xorValue64bit, true), 0x701ECEB219A8E5D5);
+    TestCRC64(CalculateCRC64ReflectedSlicing8(crcReflectedSlicingTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true));
+    TestCRC64(CalculateCRC64ReflectedSlicing16(crcReflectedSlicingTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true));
+
+    //CRC64 carry-less multiply folding against the byte loop
+    CrcClmulConstantsGenerator(polynominal64bit, 64, crcClmulConstants);
+
+    TestCRC64(CalculateCRC64Clmul(crcTable64bit, crcClmulConstants, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), initValue64bit, xorValue64bit, true, true));
+    TestCRC64(CalculateCRC64Clmul(crcTable64bit, crcClmulConstants, longMessage, 200, initValue64bit, xorValue64bit, true, true),
+              CalculateCRC64(crcTable64bit, longMessage, 200, initValue64bit, xorValue64bit, true, true));
+    TestCRC64(CalculateCRC64Clmul(crcTable64bit, crcClmulConstants, longMessage, sizeof(longMessage), 0x0123456789ABCDEF, 0, false, false),
+              CalculateCRC64(crcTable64bit, longMessage, sizeof(longMessage), 0x0123456789ABCDEF, 0, false, false));
+
+    //Nibble table and bitwise tiers against the byte loop
+    Crc8NibbleTableGenerator(0x1D, crcNibbleTable8bit);
+    Crc16NibbleTableGenerator(polynominal16bit, crcNibbleTable16bit);
+    Crc32NibbleTableGenerator(polynominal32bit, crcNibbleTable32bit);
+    Crc64NibbleTableGenerator(polynominal64bit, crcNibbleTable64bit);
+
+    TestCRC8(CalculateCRC8Nibble(crcNibbleTable8bit, message5, sizeof(message5), 0xFF, 0xFF, false, false), 0xCB);
+    TestCRC8(CalculateCRC8Bitwise(0x1D, message5, sizeof(message5), 0xFF, 0xFF, false, false), 0xCB);
+    TestCRC16(CalculateCRC16Nibble(crcNibbleTable16bit, message5, sizeof(message5), initValue16bit, xorValue16bit, false, false), 0xF53F);
+    TestCRC16(CalculateCRC16Bitwise(polynominal16bit, message5, sizeof(message5), initValue16bit, xorValue16bit, false, false), 0xF53F);
+    TestCRC32(CalculateCRC32Nibble(crcNibbleTable32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true, true), 0xB0AE863D);
+    TestCRC32(CalculateCRC32Bitwise(polynominal32bit, message5, sizeof(message5), initValue32bit, xorValue32bit, true, true), 0xB0AE863D);
+    TestCRC64(CalculateCRC64Nibble(crcNibbleTable64bit, message5, sizeof(message5), initValue64bit, xorValue64bit, true, true), 0x701ECEB219A8E5D5);
+    TestCRC64(CalculateCRC64Bitwise(polynominal64bit, message5, sizeof(message5), initValue64bit, xorValue64bit, true, true), 0x701ECEB219A8E5D5);
+    TestCRC32(CalculateCRC32Nibble(crcNibbleTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, false, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, false, true));
+    TestCRC32(CalculateCRC32Bitwise(polynominal32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, true, false),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, true, false));
+
+    //Compile time models, tables are generated by the compiler
+    static constexpr uint8_t constMessage5[] = { 0x33, 0x22, 0x55, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0XFF };
+    static_assert(0xCB == Crc8SaeJ1850::Calculate(constMessage5, sizeof(constMessage5)), "CRC8 SAE-J1850 model");
+    static_assert(0xB0AE863D == Crc32Ethernet::Calculate(constMessage5, sizeof(constMessage5)), "CRC32 Ethernet model");
+    static_assert(0xA65A343D == Crc32P4::Calculate(constMessage5, sizeof(constMessage5)), "CRC32 P4 model");
+    static_assert(0x701ECEB219A8E5D5 == Crc64Ecma::Calculate(constMessage5, sizeof(constMessage5)), "CRC64 ECMA model");
+    static_assert(0xF53F == Crc16CcittFalse::WithTableMode<CRC_TABLE_NIBBLE>::Calculate(constMessage5, sizeof(constMessage5)), "CRC16 nibble model");
+    static_assert(0xB0AE863D == Crc32Ethernet::WithTableMode<CRC_TABLE_NIBBLE>::Calculate(constMessage5, sizeof(constMessage5)), "CRC32 nibble model");
+    static_assert(0xB0AE863D == Crc32Ethernet::WithTableMode<CRC_TABLE_BITWISE>::Calculate(constMessage5, sizeof(constMessage5)), "CRC32 bitwise model");
+    static_assert(64 == Crc32Ethernet::WithTableMode<CRC_TABLE_NIBBLE>::tableSize, "CRC32 nibble table size");
+
+    TestCRC8(Crc8SaeJ1850::Calculate(message2, sizeof(message2)), 0x37);
+    TestCRC8(Crc8SaeJ1850::Calculate(message6, sizeof(message6)), 0x8C);
+    TestCRC8(Crc8H2F::Calculate(message2, sizeof(message2)), 0xC2);
+    TestCRC8(Crc8H2F::Calculate(message5, sizeof(message5)), 0x11);
+    TestCRC16(Crc16CcittFalse::Calculate(message3, sizeof(message3)), 0x2023);
+    TestCRC16(Crc16CcittFalse::Calculate(message7, sizeof(message7)), 0x1D0F);
+    TestCRC32(Crc32Ethernet::Calculate(message4, sizeof(message4)), 0x32A06212);
+    TestCRC32(Crc32Ethernet::Calculate(message6, sizeof(message6)), 0x9CDEA29B);
+
+    //AUTOSAR interface, message5 given in two parts
+    TestCRC8(Crc_CalculateCRC8(message5, sizeof(message5), 0x00, true), 0xCB);
+    TestCRC8(Crc_CalculateCRC8(&message5[4], 5, Crc_CalculateCRC8(message5, 4, 0x00, true), false), 0xCB);
+    TestCRC8(Crc_CalculateCRC8H2F(&message5[4], 5, Crc_CalculateCRC8H2F(message5, 4, 0x00, true), false), 0x11);
+    TestCRC16(Crc_CalculateCRC16(&message5[4], 5, Crc_CalculateCRC16(message5, 4, 0x0000, true), false), 0xF53F);
+    TestCRC32(Crc_CalculateCRC32(&message5[4], 5, Crc_CalculateCRC32(message5, 4, 0x00000000, true), false), 0xB0AE863D);
+    TestCRC32(Crc_CalculateCRC32P4(&message5[4], 5, Crc_CalculateCRC32P4(message5, 4, 0x00000000, true), false), 0xA65A343D);
+    TestCRC64(Crc_CalculateCRC64(&message5[4], 5, Crc_CalculateCRC64(message5, 4, 0x0000000000000000, true), false), 0x701ECEB219A8E5D5);
+
+    //Streaming state, message5 given in three parts
+    CrcContext<Crc32Ethernet> crc32Context;
+    crc32Context.Init();
+    crc32Context.Update(message5, 2);
+    crc32Context.Update(&message5[2], 0);
+    crc32Context.Update(&message5[2], 3);
+    crc32Context.Update(&message5[5], 4);
+    TestCRC32(crc32Context.Finalize(), 0xB0AE863D);
+
+    //Combine CRCs of two parts against CRC of the whole buffer
+    uint8_t zeroMessage[300] = { 0 };
+    uint32_t splitLength = 500;
+
+    TestCRC8(Crc8SaeJ1850::Combine(Crc8SaeJ1850::Calculate(longMessage, splitLength), Crc8SaeJ1850::Calculate(&longMessage[splitLength], sizeof(longMessage) - splitLength), sizeof(longMessage) - splitLength),
+             Crc8SaeJ1850::Calculate(longMessage, sizeof(longMessage)));
+    TestCRC16(Crc16CcittFalse::Combine(Crc16CcittFalse::Calculate(longMessage, splitLength), Crc16CcittFalse::Calculate(&longMessage[splitLength], sizeof(longMessage) - splitLength), sizeof(longMessage) - splitLength),
+              Crc16CcittFalse::Calculate(longMessage, sizeof(longMessage)));
+    TestCRC32(Crc32Ethernet::Combine(Crc32Ethernet::Calculate(longMessage, splitLength), Crc32Ethernet::Calculate(&longMessage[splitLength], sizeof(longMessage) - splitLength), sizeof(longMessage) - splitLength),
+              Crc32Ethernet::Calculate(longMessage, sizeof(longMessage)));
+    TestCRC32(CrcCombine<uint32_t>(CalculateCRC32(crcTable32bit, longMessage, splitLength, 0x12345678, 0x0000FFFF, false, true),
+                                   CalculateCRC32(crcTable32bit, &longMessage[splitLength], sizeof(longMessage) - splitLength, 0x12345678, 0x0000FFFF, false, true),
+                                   sizeof(longMessage) - splitLength, polynominal32bit, 0x12345678, 0x0000FFFF, false),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, false, true));
+
+    //CRC of zero bytes without data
+    TestCRC16(CalculateCRCZeros<uint16_t>(sizeof(zeroMessage), polynominal16bit, initValue16bit, xorValue16bit, false),
+              CalculateCRC16(crcTable16bit, zeroMessage, sizeof(zeroMessage), initValue16bit, xorValue16bit, false, false));
+    TestCRC32(CalculateCRCZeros<uint32_t>(sizeof(zeroMessage), polynominal32bit, initValue32bit, xorValue32bit, true),
+              CalculateCRC32(crcTable32bit, zeroMessage, sizeof(zeroMessage), initValue32bit, xorValue32bit, true, true));
+
+    //CRC after an in-place change of a few bytes against CRC of the changed buffer
+    uint8_t changedMessage[sizeof(longMessage)];
+    uint8_t newBytes[5] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x42 };
+    uint32_t changedOffset = 700;
+    for (uint32_t i = 0U; i < sizeof(longMessage); i++)
+    {
+        changedMessage[i] = longMessage[i];
+    }
+    for (uint32_t i = 0U; i < sizeof(newBytes); i++)
+    {
+        changedMessage[changedOffset + i] = newBytes[i];
+    }
+
+    TestCRC16(CrcUpdateInPlace<uint16_t>(crcTable16bit, CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, false),
+                                         sizeof(longMessage), changedOffset, &longMessage[changedOffset], newBytes, sizeof(newBytes), polynominal16bit, xorValue16bit, false, false),
+              CalculateCRC16(crcTable16bit, changedMessage, sizeof(changedMessage), initValue16bit, xorValue16bit, false, false));
+    TestCRC32(CrcUpdateInPlace<uint32_t>(crcTable32bit, CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true),
+                                         sizeof(longMessage), changedOffset, &longMessage[changedOffset], newBytes, sizeof(newBytes), polynominal32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, changedMessage, sizeof(changedMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC8(Crc8SaeJ1850::UpdateInPlace(Crc8SaeJ1850::Calculate(longMessage, sizeof(longMessage)), sizeof(longMessage), changedOffset, &longMessage[changedOffset], newBytes, sizeof(newBytes)),
+             Crc8SaeJ1850::Calculate(changedMessage, sizeof(changedMessage)));
+    TestCRC32(Crc32P4::UpdateInPlace(Crc32P4::Calculate(longMessage, sizeof(longMessage)), sizeof(longMessage), changedOffset, &longMessage[changedOffset], newBytes, sizeof(newBytes)),
+              Crc32P4::Calculate(changedMessage, sizeof(changedMessage)));
+
+    //Change of the first and of the last byte
+    uint64_t crc64Changed = Crc64Ecma::UpdateInPlace(Crc64Ecma::Calculate(changedMessage, sizeof(changedMessage)), sizeof(changedMessage), 0, &changedMessage[0], &newBytes[0], 1);
+    crc64Changed = Crc64Ecma::UpdateInPlace(crc64Changed, sizeof(changedMessage), sizeof(changedMessage) - 1, &changedMessage[sizeof(changedMessage) - 1], &newBytes[1], 1);
+    changedMessage[0] = newBytes[0];
+    changedMessage[sizeof(changedMessage) - 1] = newBytes[1];
+    TestCRC64(crc64Changed, Crc64Ecma::Calculate(changedMessage, sizeof(changedMessage)));
+
+    //Parallel CRC of a large buffer against one thread
+    std::vector<uint8_t> largeMessage(3 * 1024 * 1024 + 5);
+    for (uint32_t i = 0U; i < largeMessage.size(); i++)
+    {
+        largeMessage[i] = (uint8_t)(i * 31U + (i >> 12));
+    }
+
+    CrcClmulConstantsGenerator(polynominal16bit, 16, crcClmulConstants);
+    TestCRC16(CalculateCRC16Parallel(crcTable16bit, crcClmulConstants, largeMessage.data(), largeMessage.size(), initValue16bit, xorValue16bit, false, false),
+              CalculateCRC16(crcTable16bit, largeMessage.data(), (uint32_t)largeMessage.size(), initValue16bit, xorValue16bit, false, false));
+
+    CrcClmulConstantsGenerator(polynominal32bit, 32, crcClmulConstants);
+    TestCRC32(CalculateCRC32Parallel(crcTable32bit, crcClmulConstants, largeMessage.data(), largeMessage.size(), initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, largeMessage.data(), (uint32_t)largeMessage.size(), initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32Parallel(crcTable32bit, crcClmulConstants, largeMessage.data(), largeMessage.size(), 0x12345678, 0x0000FFFF, false, true),
+              CalculateCRC32(crcTable32bit, largeMessage.data(), (uint32_t)largeMessage.size(), 0x12345678, 0x0000FFFF, false, true));
+
+    //Batch of short messages against one message at a time
+    const uint32_t nBatchMessages = 40U;
+    const uint8_t *batchDataPtrs[nBatchMessages];
+    uint32_t batchLengths[nBatchMessages];
+    uint8_t batchResults8bit[nBatchMessages];
+    uint16_t batchResults16bit[nBatchMessages];
+    uint32_t batchResults32bit[nBatchMessages];
+
+    for (uint32_t i = 0U; i < nBatchMessages; i++)
+    {
+        batchDataPtrs[i] = &longMessage[i * 17U];
+        batchLengths[i] = (i * 7U) % 61U;
+    }
+
+    CalculateCRC8Batch(crcTable8bit, batchDataPtrs, batchLengths, nBatchMessages, initValue, xorValue, false, false, batchResults8bit);
+    CalculateCRC16Batch(crcTable16bit, batchDataPtrs, batchLengths, nBatchMessages, initValue16bit, xorValue16bit, false, false, batchResults16bit);
+    CalculateCRC32Batch(crcTable32bit, batchDataPtrs, batchLengths, nBatchMessages, initValue32bit, xorValue32bit, true, true, batchResults32bit);
+
+    for (uint32_t i = 0U; i < nBatchMessages; i++)
+    {
+        TestCRC8(batchResults8bit[i], CalculateCRC8(crcTable8bit, batchDataPtrs[i], batchLengths[i], initValue, xorValue, false, false));
+        TestCRC16(batchResults16bit[i], CalculateCRC16(crcTable16bit, batchDataPtrs[i], batchLengths[i], initValue16bit, xorValue16bit, false, false));
+        TestCRC32(batchResults32bit[i], CalculateCRC32(crcTable32bit, batchDataPtrs[i], batchLengths[i], initValue32bit, xorValue32bit, true, true));
+    }
+
+    CalculateCRC32Batch(crcTable32bit, batchDataPtrs, batchLengths, 5U, 0x12345678, 0x0000FFFF, false, true, batchResults32bit);
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        TestCRC32(batchResults32bit[i], CalculateCRC32(crcTable32bit, batchDataPtrs[i], batchLengths[i], 0x12345678, 0x0000FFFF, false, true));
+    }
+
+    //Fragmented message against the contiguous one
+    CrcSegment segments[] = { { &longMessage[0], 3 }, { &longMessage[3], 0 }, { &longMessage[3], 200 }, { &longMessage[203], 1 },
+                              { &longMessage[204], 700 }, { &longMessage[904], 123 } };
+    uint32_t nSegments = sizeof(segments) / sizeof(segments[0]);
+
+    TestCRC8(CalculateCRC8Segments(crcTable8bit, nullptr, segments, nSegments, initValue, xorValue, false, false),
+             CalculateCRC8(crcTable8bit, longMessage, sizeof(longMessage), initValue, xorValue, false, false));
+    TestCRC16(CalculateCRC16Segments(crcTable16bit, nullptr, segments, nSegments, initValue16bit, xorValue16bit, false, true),
+              CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), initValue16bit, xorValue16bit, false, true));
+    TestCRC32(CalculateCRC32Segments(crcTable32bit, crcClmulConstants, segments, nSegments, initValue32bit, xorValue32bit, true, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC32(CalculateCRC32Segments(crcTable32bit, crcClmulConstants, segments, nSegments, 0x12345678, 0x0000FFFF, false, true),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), 0x12345678, 0x0000FFFF, false, true));
+
+    //Model catalogue, every model against its check value
+    static const uint8_t checkMessage[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+    for (uint32_t id = 0; id < CRC_MODEL_COUNT; id++)
+    {
+        const CrcRegisteredModel *model = CrcGetModel((CrcModelId)id);
+        TestCRC64(model->Calculate(checkMessage, sizeof(checkMessage)), model->parameters.check);
+        TestCRC64(model->Finalize(model->Update(model->Update(model->Start(), checkMessage, 4), &checkMessage[4], 5)), model->parameters.check);
+        TestCRC64(model->Calculate(longMessage, sizeof(longMessage)), model->Finalize(model->Update(model->Start(), longMessage, sizeof(longMessage))));
+        TestCRC64(model->Finalize(model->Update(model->Update(model->Start(), longMessage, 100), &longMessage[100], sizeof(longMessage) - 100)),
+                  model->Calculate(longMessage, sizeof(longMessage)));
+        TestCRC64(model->Combine(model->Calculate(longMessage, 17), model->Calculate(&longMessage[17], sizeof(longMessage) - 17), sizeof(longMessage) - 17),
+                  model->Calculate(longMessage, sizeof(longMessage)));
+    }
+
+    //Reflected 8 and 16 bit tables: CRC-8/MAXIM-DOW, CRC-16/ARC, CRC-16/MODBUS and CRC-16/KERMIT check values, slicing
+    //against the byte loop with reflected input
+    uint8_t crcReflectedTable8bit[256];
+    uint16_t crcReflectedTable16bit[256];
+    uint16_t crcReflectedSlicingTable16bit[16][256];
+
+    Crc8ReflectedTableGenerator(0x31, crcReflectedTable8bit);
+    TestCRC8(CalculateCRC8Reflected(crcReflectedTable8bit, checkMessage, sizeof(checkMessage), 0x00, 0x00, true), 0xA1);
+
+    Crc16ReflectedTableGenerator(0x8005, crcReflectedTable16bit);
+    Crc16ReflectedSlicingTableGenerator(0x8005, crcReflectedSlicingTable16bit, 16);
+    TestCRC16(CalculateCRC16Reflected(crcReflectedTable16bit, checkMessage, sizeof(checkMessage), 0x0000, 0x0000, true), 0xBB3D);
+    TestCRC16(CalculateCRC16ReflectedSlicing8(crcReflectedSlicingTable16bit, checkMessage, sizeof(checkMessage), 0x0000, 0x0000, true), 0xBB3D);
+    TestCRC16(CalculateCRC16ReflectedSlicing8(crcReflectedSlicingTable16bit, checkMessage, sizeof(checkMessage), 0xFFFF, 0x0000, true), 0x4B37);
+    TestCRC16(CalculateCRC16ReflectedSlicing16(crcReflectedSlicingTable16bit, longMessage, sizeof(longMessage), 0xFFFF, 0x0000, true),
+              (uint16_t)CrcGetModel(CRC_MODEL_CRC16_MODBUS)->Calculate(longMessage, sizeof(longMessage)));
+
+    Crc16ReflectedSlicingTableGenerator(0x1021, crcReflectedSlicingTable16bit, 16);
+    TestCRC16(CalculateCRC16ReflectedSlicing16(crcReflectedSlicingTable16bit, checkMessage, sizeof(checkMessage), 0x0000, 0x0000, true), 0x2189);
+    TestCRC16(CalculateCRC16ReflectedSlicing16(crcReflectedSlicingTable16bit, longMessage, sizeof(longMessage), 0x1234, 0x00FF, false),
+              CalculateCRC16(crcTable16bit, longMessage, sizeof(longMessage), 0x1234, 0x00FF, false, true));
+
+    //Widths other than 8/16/32/64 bits with left aligned tables against the catalogue
+    uint16_t crcTable15bit[256];
+    uint32_t crcTable21bit[256];
+    uint32_t crcNibbleTable21bit[16];
+    uint32_t crcSlicingTable24bit[8][256];
+    uint8_t crcReflectedTable5bit[256];
+    uint8_t crcTable3bit[256];
+
+    CrcTableGenerator<uint16_t>(0x4599, crcTable15bit, 15);
+    CrcTableGenerator<uint32_t>(0x102899, crcTable21bit, 21);
+    CrcNibbleTableGenerator<uint32_t>(0x102899, crcNibbleTable21bit, 21);
+    CrcSlicingTableGenerator<uint32_t>(0x864CFB, crcSlicingTable24bit, 8, 24);
+    CrcReflectedTableGenerator<uint8_t>(0x05, crcReflectedTable5bit, 5);
+    CrcTableGenerator<uint8_t>(0x3, crcTable3bit, 3);
+
+    TestCRC16(CalculateCRC<uint16_t>(crcTable15bit, checkMessage, sizeof(checkMessage), 0, 0, false, false, 15), 0x059E);
+    TestCRC32(CalculateCRC<uint32_t>(crcTable21bit, checkMessage, sizeof(checkMessage), 0, 0, false, false, 21), 0x0ED841);
+    TestCRC32(CalculateCRCNibble<uint32_t>(crcNibbleTable21bit, checkMessage, sizeof(checkMessage), 0, 0, false, false, 21), 0x0ED841);
+    TestCRC32(CalculateCRCBitwise<uint32_t>(0x102899, checkMessage, sizeof(checkMessage), 0, 0, false, false, 21), 0x0ED841);
+    TestCRC32(CalculateCRCSlicing<uint32_t, 8>(crcSlicingTable24bit, longMessage, sizeof(longMessage), 0xB704CE, 0, false, false, 24),
+              (uint32_t)CrcGetModel(CRC_MODEL_CRC24_OPENPGP)->Calculate(longMessage, sizeof(longMessage)));
+    TestCRC8(CalculateCRCReflected<uint8_t>(crcReflectedTable5bit, checkMessage, sizeof(checkMessage), 0x1F, 0x1F, true, 5), 0x19);
+    TestCRC8(CalculateCRC<uint8_t>(crcTable3bit, checkMessage, sizeof(checkMessage), 0x7, 0, true, true, 3), 0x6);
+    TestCRC16(CalculateCRC<uint16_t>(crcTable15bit, longMessage, sizeof(longMessage), 0x1234, 0x7FFF, true, true, 15),
+              CalculateCRCBitwise<uint16_t>(0x4599, longMessage, sizeof(longMessage), 0x1234, 0x7FFF, true, true, 15));
+
+    //Combine, zeros and in-place change with the width argument: CAN CRCs of a message split 17 + 23 bytes
+    uint32_t crcTable17bit[256];
+    CrcTableGenerator<uint32_t>(0x1685B, crcTable17bit, 17);
+
+    TestCRC16(CrcCombine<uint16_t>(CalculateCRC<uint16_t>(crcTable15bit, longMessage, 17, 0, 0, false, false, 15),
+                                   CalculateCRC<uint16_t>(crcTable15bit, &longMessage[17], 23, 0, 0, false, false, 15), 23, 0x4599, 0, 0, false, 15),
+              CalculateCRC<uint16_t>(crcTable15bit, longMessage, 40, 0, 0, false, false, 15));
+    TestCRC16(CrcCombine<uint16_t>(CalculateCRC<uint16_t>(crcTable15bit, longMessage, 17, 0x1234, 0x7FFF, true, true, 15),
+                                   CalculateCRC<uint16_t>(crcTable15bit, &longMessage[17], 23, 0x1234, 0x7FFF, true, true, 15), 23, 0x4599, 0x1234, 0x7FFF, true, 15),
+              CalculateCRC<uint16_t>(crcTable15bit, longMessage, 40, 0x1234, 0x7FFF, true, true, 15));
+    TestCRC32(CrcCombine<uint32_t>(CalculateCRC<uint32_t>(crcTable17bit, longMessage, 17, 0, 0, false, false, 17),
+                                   CalculateCRC<uint32_t>(crcTable17bit, &longMessage[17], 23, 0, 0, false, false, 17), 23, 0x1685B, 0, 0, false, 17),
+              (uint32_t)CrcGetModel(CRC_MODEL_CRC17_CAN_FD)->Calculate(longMessage, 40));
+    TestCRC32(CrcCombine<uint32_t>(CalculateCRC<uint32_t>(crcTable21bit, longMessage, 17, 0, 0, false, false, 21),
+                                   CalculateCRC<uint32_t>(crcTable21bit, &longMessage[17], 23, 0, 0, false, false, 21), 23, 0x102899, 0, 0, false, 21),
+              (uint32_t)CrcGetModel(CRC_MODEL_CRC21_CAN_FD)->Calculate(longMessage, 40));
+    TestCRC32(CalculateCRCZeros<uint32_t>(40, 0x102899, 0x1ABCD, 0x0F0F0, true, 21),
+              CalculateCRCBitwise<uint32_t>(0x102899, zeroMessage, 40, 0x1ABCD, 0x0F0F0, true, false, 21));
+    uint8_t changedCanMessage[40];
+    for (uint32_t i = 0U; i < sizeof(changedCanMessage); i++)
+    {
+        changedCanMessage[i] = ((i >= 10) && (i < 10 + sizeof(newBytes))) ? newBytes[i - 10] : longMessage[i];
+    }
+    TestCRC16(CrcUpdateInPlace<uint16_t>(crcTable15bit, CalculateCRC<uint16_t>(crcTable15bit, longMessage, 40, 0x1234, 0x7FFF, true, true, 15),
+                                         40, 10, &longMessage[10], newBytes, sizeof(newBytes), 0x4599, 0x7FFF, true, true, 15),
+              CalculateCRC<uint16_t>(crcTable15bit, changedCanMessage, 40, 0x1234, 0x7FFF, true, true, 15));
+
+    //Bit granular length: with initial value 0, leading zero bits do not change the CRC, so the bit stream moved
+    //to the end of a whole number of bytes has the same CRC
+    uint8_t alignedMessage[sizeof(message5) + 1];
+    for (uint8_t tailBits = 1; tailBits < 8; tailBits++)
+    {
+        uint64_t nBits = 8 * (sizeof(message5) - 1) + tailBits;
+        uint32_t nAligned = (uint32_t)((nBits + 7) / 8);
+
+        // MSB first stream
+        for (uint32_t i = 0U; i < nAligned; i++)
+        {
+            alignedMessage[i] = 0;
+        }
+        for (uint64_t bit = 0U; bit < nBits; bit++)
+        {
+            uint64_t alignedBit = bit + 8 * nAligned - nBits;
+            alignedMessage[alignedBit / 8] |= (uint8_t)(((message5[bit / 8] >> (7 - bit % 8)) & 0x01) << (7 - alignedBit % 8));
+        }
+        TestCRC16(CalculateCRCBits<uint16_t>(crcTable15bit, message5, nBits, 0, 0, false, false, 15),
+                  CalculateCRC<uint16_t>(crcTable15bit, alignedMessage, nAligned, 0, 0, false, false, 15));
+
+        // LSB first stream
+        for (uint32_t i = 0U; i < nAligned; i++)
+        {
+            alignedMessage[i] = 0;
+        }
+        for (uint64_t bit = 0U; bit < nBits; bit++)
+        {
+            uint64_t alignedBit = bit + 8 * nAligned - nBits;
+            alignedMessage[alignedBit / 8] |= (uint8_t)(((message5[bit / 8] >> (bit % 8)) & 0x01) << (alignedBit % 8));
+        }
+        TestCRC32(CalculateCRCBits<uint32_t>(crcTable32bit, message5, nBits, 0, xorValue32bit, true, true),
+                  CalculateCRC32(crcTable32bit, alignedMessage, nAligned, 0, xorValue32bit, true, true));
+    }
+    TestCRC32(CalculateCRCBits<uint32_t>(crcTable21bit, longMessage, 8 * sizeof(longMessage), 0, 0, false, false, 21),
+              (uint32_t)CrcGetModel(CRC_MODEL_CRC21_CAN_FD)->Calculate(longMessage, sizeof(longMessage)));
+
+    //Parameter solver: samples of the same length (GCD) and of different lengths only (search of all polynomials)
+    const uint8_t *solverMessages[] = { message1, message3, message4, message7, message2, message5, longMessage, longMessage };
+    uint32_t solverLengths[] = { sizeof(message1), sizeof(message3), sizeof(message4), sizeof(message7), sizeof(message2), sizeof(message5), 20, 100 };
+    static const CrcModelId solverModels[] = { CRC_MODEL_CRC16_MODBUS, CRC_MODEL_CRC32_BZIP2, CRC_MODEL_CRC40_GSM, CRC_MODEL_CRC64_WE,
+                                               CRC_MODEL_CRC8_ROHC, CRC_MODEL_CRC15_CAN, CRC_MODEL_CRC5_USB };
+    CrcSolverSample samples[8];
+    CrcSolverResult solutions[4];
+
+    for (uint32_t i = 0; i < sizeof(solverModels) / sizeof(solverModels[0]); i++)
+    {
+        const CrcRegisteredModel *model = CrcGetModel(solverModels[i]);
+        uint32_t first = (model->parameters.width > 16) ? 0 : 4;    // only different lengths for the narrow ones
+
+        for (uint32_t j = first; j < 8; j++)
+        {
+            samples[j - first] = { solverMessages[j], solverLengths[j], model->Calculate(solverMessages[j], solverLengths[j]) };
+        }
+
+        uint32_t nSolutions = CrcSolve(model->parameters.width, samples, 8 - first, solutions, 4, CRC_SOLVER_SEARCH_LIMIT);
+        TestCRC8((uint8_t)nSolutions, 1);
+        TestCRC8((uint8_t)(solutions[0].parameters.name == model->parameters.name), 1);
+        TestCRC64(solutions[0].parameters.check, model->parameters.check);
+    }
+
+    // parameters which are not in the catalogue
+    for (uint32_t j = 0; j < 8; j++)
+    {
+        samples[j] = { solverMessages[j], solverLengths[j], CalculateCRCBitwise<uint16_t>(0x8BB7, solverMessages[j], solverLengths[j], 0x1234, 0x5555, false, true) };
+    }
+    TestCRC8((uint8_t)CrcSolve(16, samples, 8, solutions, 4, CRC_SOLVER_SEARCH_LIMIT), 1);
+    TestCRC8((uint8_t)(nullptr == solutions[0].parameters.name), 1);
+    TestCRC8((uint8_t)solutions[0].uniqueInitialValue, 1);
+    TestCRC16((uint16_t)solutions[0].parameters.polynomial, 0x8BB7);
+    TestCRC16((uint16_t)solutions[0].parameters.initialValue, 0x1234);
+    TestCRC16((uint16_t)solutions[0].parameters.xorValue, 0x5555);
+    TestCRC8((uint8_t)(solutions[0].parameters.reflectedInput && !solutions[0].parameters.reflectedOutput), 1);
+
+    // a single pair of the same length leaves 2^31 polynomials for 32 bits, the search is skipped
+    const CrcRegisteredModel *solverModel = CrcGetModel(CRC_MODEL_CRC32_BZIP2);
+    for (uint32_t j = 0; j < 4; j++)
+    {
+        samples[j] = { solverMessages[j + 2], solverLengths[j + 2], solverModel->Calculate(solverMessages[j + 2], solverLengths[j + 2]) };
+    }
+    TestCRC8((uint8_t)(CrcSolveCandidates(32, samples, 4) > CRC_SOLVER_SEARCH_LIMIT), 1);
+    TestCRC8((uint8_t)CrcSolve(32, samples, 4, solutions, 4, CRC_SOLVER_SEARCH_LIMIT), 0);
+
+    //Hamming distance against the published lengths: 0x2F HD 4 up to 119 data bits, 0x1D HD 3 up to 247 data bits,
+    //CCITT HD 4 up to 32751 data bits, CRC32P4 HD 6 for 4 KiB
+    static const uint32_t hammingLengths8bit[] = { 64, 119, 120, 247, 248 };
+    static const uint32_t hammingLengths16bit[] = { 32751, 32752 };
+    static const uint32_t hammingLengths32bit[] = { 4096 };
+    CrcHammingResult hamming[5];
+
+    CrcHammingEvaluate(8, 0x2F, hammingLengths8bit, 5, hamming);
+    TestCRC8(hamming[0].hammingDistance, 4);
+    TestCRC64(hamming[0].undetected, 8210);
+    TestCRC8(hamming[1].hammingDistance, 4);
+    TestCRC8(hamming[2].hammingDistance, 2);
+    CrcHammingEvaluate(8, 0x1D, hammingLengths8bit, 5, hamming);
+    TestCRC8(hamming[3].hammingDistance, 3);
+    TestCRC8(hamming[4].hammingDistance, 2);
+    TestCRC64(hamming[4].undetected, 1);
+    CrcHammingEvaluate(16, 0x1021, hammingLengths16bit, 2, hamming);
+    TestCRC8(hamming[0].hammingDistance, 4);
+    TestCRC8(hamming[1].hammingDistance, 2);
+    CrcHammingEvaluate(32, 0xF4ACFB13, hammingLengths32bit, 1, hamming);
+    TestCRC8(hamming[0].hammingDistance, CRC_HAMMING_MAX_WEIGHT + 1);
+
+    //Instrumentation, counted only when built with -DCRC_STATS. The registry model calls the clmul and table kernels,
+    //only the outermost call is counted. Short data of a reflected model goes to the reflected kernel.
+    CrcStatsRecord statsRecords[CRC_STATS_MODEL_COUNT * CRC_STATS_KERNEL_COUNT];
+
+    CrcStatsReset();
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true);
+    }
+    CrcGetModel(CRC_MODEL_CRC16_MODBUS)->Calculate(message5, sizeof(message5));
+
+    uint32_t nStatsRecords = CrcStatsSnapshot(statsRecords, CRC_STATS_MODEL_COUNT * CRC_STATS_KERNEL_COUNT);
+#ifdef CRC_STATS
+    TestCRC8((uint8_t)nStatsRecords, 2);
+    TestCRC8((uint8_t)(CRC_MODEL_CRC16_MODBUS == statsRecords[0].model && CRC_STATS_REFLECTED == statsRecords[0].kernel), 1);
+    TestCRC64(statsRecords[0].calls, 1);
+    TestCRC64(statsRecords[0].sizes[4], 1);
+    TestCRC8((uint8_t)(CRC_STATS_MODEL_CRC32 == statsRecords[1].model && CRC_STATS_TABLE == statsRecords[1].kernel), 1);
+    TestCRC64(statsRecords[1].calls, 3);
+    TestCRC64(statsRecords[1].bytes, 3 * sizeof(longMessage));
+    TestCRC64(statsRecords[1].sizes[11], 3);
+#else
+    TestCRC8((uint8_t)nStatsRecords, 0);
+#endif
+
+#if defined(__linux__)
+    //Service: server in a thread of this process, inline and shared memory requests of several models
+    char servicePath[64];
+    snprintf(servicePath, sizeof(servicePath), "/tmp/crcServiceTest%d.sock", (int)getpid());
+    CrcServiceServer server;
+    TestCRC8((uint8_t)server.Open(servicePath), 1);
+    std::thread serverThread(&CrcServiceServer::Run, &server);
+    {
+        CrcServiceClient client;
+        uint64_t serviceCrc = 0;
+        TestCRC8((uint8_t)client.Connect(servicePath), 1);
+        TestCRC8((uint8_t)client.Calculate(CRC_MODEL_CRC32, message5, sizeof(message5), serviceCrc), 1);
+        TestCRC64(serviceCrc, 0xB0AE863D);
+
+        const uint8_t *serviceDataPtrs[nBatchMessages];
+        uint32_t serviceLengths[nBatchMessages];
+        uint64_t serviceResults[nBatchMessages];
+        const CrcModelId serviceModels[] = {CRC_MODEL_CRC8H2F, CRC_MODEL_CRC16_MODBUS, CRC_MODEL_CRC32P4, CRC_MODEL_CRC64, CRC_MODEL_CRC15_CAN};
+        for (uint32_t i = 0; i < nBatchMessages; i++)
+        {
+            serviceDataPtrs[i] = longMessage + i * 7U;
+            serviceLengths[i] = (i == nBatchMessages - 1) ? (uint32_t)(sizeof(longMessage) - i * 7U) : i;
+        }
+        for (CrcModelId id : serviceModels)
+        {
+            TestCRC8((uint8_t)client.CalculateBatch(id, serviceDataPtrs, serviceLengths, nBatchMessages, serviceResults), 1);
+            for (uint32_t i = 0; i < nBatchMessages; i++)
+            {
+                TestCRC64(serviceResults[i], CrcGetModel(id)->Calculate(serviceDataPtrs[i], serviceLengths[i]));
+            }
+        }
+
+        uint8_t *sharedBuffer = client.AttachSharedBuffer(sizeof(longMessage));
+        TestCRC8((uint8_t)(nullptr != sharedBuffer), 1);
+        memcpy(sharedBuffer, longMessage, sizeof(longMessage));
+        for (uint32_t i = 0; i < nBatchMessages; i++)
+        {
+            serviceDataPtrs[i] = sharedBuffer + i * 7U;
+        }
+        TestCRC8((uint8_t)client.CalculateBatch(CRC_MODEL_CRC32, serviceDataPtrs, serviceLengths, nBatchMessages, serviceResults), 1);
+        for (uint32_t i = 0; i < nBatchMessages; i++)
+        {
+            TestCRC64(serviceResults[i], CrcGetModel(CRC_MODEL_CRC32)->Calculate(longMessage + i * 7U, serviceLengths[i]));
+        }
+
+        // More responses than CRC_SERVICE_OUTPUT_LIMIT: sent in chunks, otherwise server and client would both wait
+        const uint32_t nLargeBatch = 10000U;
+        std::vector<const uint8_t *> largeDataPtrs(nLargeBatch);
+        std::vector<uint32_t> largeLengths(nLargeBatch);
+        std::vector<uint64_t> largeResults(nLargeBatch);
+        uint32_t largeErrors = 0;
+        for (uint32_t i = 0; i < nLargeBatch; i++)
+        {
+            largeDataPtrs[i] = longMessage + i % 1000U;
+            largeLengths[i] = i % 28U;
+        }
+        TestCRC8((uint8_t)client.CalculateBatch(CRC_MODEL_CRC16_MODBUS, largeDataPtrs.data(), largeLengths.data(), nLargeBatch, largeResults.data()), 1);
+        for (uint32_t i = 0; i < nLargeBatch; i++)
+        {
+            largeErrors += (largeResults[i] != CrcGetModel(CRC_MODEL_CRC16_MODBUS)->Calculate(largeDataPtrs[i], largeLengths[i])) ? 1U : 0U;
+        }
+        TestCRC32(largeErrors, 0);
+
+        CrcServiceResponse serviceResponse;
+        uint32_t serviceId = client.Submit(CRC_MODEL_COUNT, message5, sizeof(message5));
+        TestCRC8((uint8_t)(client.Flush() && client.Receive(serviceResponse)), 1);
+        TestCRC8((uint8_t)(serviceId == serviceResponse.id && CRC_SERVICE_UNKNOWN_MODEL == serviceResponse.status), 1);
+    }
+    server.Stop();
+    serverThread.join();
+#endif
+
+    TestCRC32((uint32_t)CrcFindModel("CRC32")->Calculate(message5, sizeof(message5)), 0xB0AE863D);
+    TestCRC64(CrcFindModel("CRC-64/XZ")->Calculate(message5, sizeof(message5)), 0x701ECEB219A8E5D5);
+    TestCRC32((uint32_t)CrcFindModel("CRC-32/ISO-HDLC")->Calculate(longMessage, sizeof(longMessage)),
+              CalculateCRC32(crcTable32bit, longMessage, sizeof(longMessage), initValue32bit, xorValue32bit, true, true));
+    TestCRC8((uint8_t)(CrcFindModel("CRC-8/NONE") == nullptr), 1);
+    TestCRC8((uint8_t)(CrcFindModel("CRC8H2F") == CrcGetModel(CRC_MODEL_CRC8H2F)), 1);
+
     return 0;
 }
\ No newline at end of file
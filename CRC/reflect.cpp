@@ -2,25 +2,26 @@
 
 uint32_t reflect(uint32_t data, uint8_t nBits)
 {
-    uint32_t  reflection = 0;
+    uint32_t  reflection = data;
 
+    if (0U == nBits)
+    {
+        return 0U;
+    }
 
     /*
-    * Reflect the data about the center bit.
+    * Reflect all 32 bits by swapping neighbouring bits, bit pairs, nibbles, bytes and half words,
+    * same number of operations for every nBits.
     */
-    for (uint8_t bit = 0; bit < nBits; ++bit)
-    {
-        /*
-        * If the LSB bit is set, set the reflection of it.
-        */
-        if (data & 0x01)
-        {
-            reflection |= (1 << ((nBits - 1) - bit));
-        }
+    reflection = ((reflection >> 1) & 0x55555555U) | ((reflection & 0x55555555U) << 1);
+    reflection = ((reflection >> 2) & 0x33333333U) | ((reflection & 0x33333333U) << 2);
+    reflection = ((reflection >> 4) & 0x0F0F0F0FU) | ((reflection & 0x0F0F0F0FU) << 4);
+    reflection = ((reflection >> 8) & 0x00FF00FFU) | ((reflection & 0x00FF00FFU) << 8);
+    reflection = (reflection >> 16) | (reflection << 16);
 
-        data = (data >> 1);
-    }
-
-    return (reflection);
+    /*
+    * Only the lower nBits are reflected about their center bit, bits above are dropped.
+    */
+    return (reflection >> (32U - nBits));
 
-}   /* reflect() */
\ No newline at end of file
+}   /* reflect() */
@@ -0,0 +1,606 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "../crcStats.h"
+
+//Throughput of every CRC kernel and table size tier for the AUTOSAR models, over buffer sizes from 1 byte up to 1 GB and at
+//misaligned start addresses. Table and constant generation is measured separately. Output is CSV (default)
+//or JSON, one record per measurement, so results of two releases can be compared by a script.
+//
+//Build:
+//    g++ -std=c++17 -O2 -pthread CRC/tools/crcBench.cpp CRC/crc8.cpp CRC/crc16.cpp CRC/crc32.cpp CRC/crc64.cpp
+//        CRC/crcClmul.cpp CRC/crcParallel.cpp CRC/crcThreadPool.cpp CRC/crcBatch.cpp CRC/crcSegments.cpp CRC/reflect.cpp -o crcBench
+//With -DCRC_STATS also CRC/crcStats.cpp CRC/crcRegistry.cpp, the call statistics are written to stderr at the end.
+//Usage:
+//    crcBench [--json] [--model NAME] [--kernel NAME] [--max-size BYTES] [--bytes BYTES] [--message-size BYTES]
+//
+// --max-size       largest buffer, default 1 GB
+// --bytes          data calculated per measurement, small buffers are repeated up to this amount, default 16 MB
+// --message-size   largest message of the batch and segments kernels, default 64 bytes
+//
+//The batch kernel cuts the buffer into messages of 4 to --message-size bytes and calculates them with one
+//CalculateCRCxxBatch() call, batch-loop calculates the same messages with one CalculateCRCxx() call each.
+//The segments kernel calculates one CRC of the buffer given as segments of the same lengths.
+//Small messages, e.g. --message-size 8 for CAN frames, show the per-message overhead of batch and segments.
+//
+//The bitwise and nibble kernels take 5 to 15 ns per byte, they stop at CRC_BENCH_BITWISE_SIZE bytes per buffer and
+//per measurement unless they are selected with --kernel.
+
+#define CRC_BENCH_MAX_SIZE  (1024ULL * 1024ULL * 1024ULL)
+#define CRC_BENCH_BYTES     (16ULL * 1024ULL * 1024ULL)
+#define CRC_BENCH_MESSAGE_SIZE  64U
+#define CRC_BENCH_BITWISE_SIZE  (1024ULL * 1024ULL)
+
+extern void Crc8TableGenerator(uint8_t polynomial, uint8_t crcTable[256]);
+extern void Crc16TableGenerator(uint16_t polynomial, uint16_t crcTable[256]);
+extern void Crc32TableGenerator(uint32_t polynomial, uint32_t crcTable[256]);
+extern void Crc64TableGenerator(uint64_t polynomial, uint64_t crcTable[256]);
+extern void Crc8ReflectedTableGenerator(uint8_t polynomial, uint8_t crcTable[256]);
+extern void Crc16ReflectedTableGenerator(uint16_t polynomial, uint16_t crcTable[256]);
+extern void Crc32ReflectedTableGenerator(uint32_t polynomial, uint32_t crcTable[256]);
+extern void Crc64ReflectedTableGenerator(uint64_t polynomial, uint64_t crcTable[256]);
+extern void Crc16SlicingTableGenerator(uint16_t polynomial, uint16_t crcTable[][256], uint8_t nSlices);
+extern void Crc32SlicingTableGenerator(uint32_t polynomial, uint32_t crcTable[][256], uint8_t nSlices);
+extern void Crc64SlicingTableGenerator(uint64_t polynomial, uint64_t crcTable[][256], uint8_t nSlices);
+extern void Crc16ReflectedSlicingTableGenerator(uint16_t polynomial, uint16_t crcTable[][256], uint8_t nSlices);
+extern void Crc32ReflectedSlicingTableGenerator(uint32_t polynomial, uint32_t crcTable[][256], uint8_t nSlices);
+extern void Crc64ReflectedSlicingTableGenerator(uint64_t polynomial, uint64_t crcTable[][256], uint8_t nSlices);
+extern void Crc8NibbleTableGenerator(uint8_t polynomial, uint8_t crcTable[16]);
+extern void Crc16NibbleTableGenerator(uint16_t polynomial, uint16_t crcTable[16]);
+extern void Crc32NibbleTableGenerator(uint32_t polynomial, uint32_t crcTable[16]);
+extern void Crc64NibbleTableGenerator(uint64_t polynomial, uint64_t crcTable[16]);
+extern void CrcClmulConstantsGenerator(uint64_t polynomial, uint8_t width, uint64_t clmulConstants[16]);
+
+extern uint8_t CalculateCRC8(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint8_t CalculateCRC8Nibble(uint8_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Nibble(uint16_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Nibble(uint32_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Nibble(uint64_t crcTable[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint8_t CalculateCRC8Bitwise(uint8_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Bitwise(uint16_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Bitwise(uint32_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Bitwise(uint64_t polynomial, const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint8_t CalculateCRC8Reflected(uint8_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput);
+extern uint16_t CalculateCRC16Reflected(uint16_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput);
+extern uint32_t CalculateCRC32Reflected(uint32_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput);
+extern uint64_t CalculateCRC64Reflected(uint64_t crcTable[256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput);
+extern uint16_t CalculateCRC16Slicing8(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Slicing16(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Slicing8(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Slicing16(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Slicing8(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Slicing16(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16ReflectedSlicing8(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput);
+extern uint16_t CalculateCRC16ReflectedSlicing16(uint16_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput);
+extern uint32_t CalculateCRC32ReflectedSlicing8(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput);
+extern uint32_t CalculateCRC32ReflectedSlicing16(uint32_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput);
+extern uint64_t CalculateCRC64ReflectedSlicing8(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput);
+extern uint64_t CalculateCRC64ReflectedSlicing16(uint64_t crcTable[][256], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput);
+extern uint8_t CalculateCRC8Clmul(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Clmul(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Clmul(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint64_t CalculateCRC64Clmul(uint64_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint32_t crc_Length, uint64_t crc_InitialValue, uint64_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint8_t CalculateCRC8Parallel(uint8_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Parallel(uint16_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Parallel(uint32_t crcTable[256], const uint64_t clmulConstants[16], const uint8_t *crc_DataPtr, uint64_t crc_Length, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern void CalculateCRC8Batch(uint8_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint8_t crcResults[]);
+extern void CalculateCRC16Batch(uint16_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint16_t crcResults[]);
+extern void CalculateCRC32Batch(uint32_t crcTable[256], const uint8_t *const crc_DataPtrs[], const uint32_t crc_Lengths[], uint32_t nMessages, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput, uint32_t crcResults[]);
+extern uint8_t CalculateCRC8Segments(uint8_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint8_t crc_InitialValue, uint8_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint16_t CalculateCRC16Segments(uint16_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint16_t crc_InitialValue, uint16_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+extern uint32_t CalculateCRC32Segments(uint32_t crcTable[256], const uint64_t clmulConstants[16], const CrcSegment crc_Segments[], uint32_t nSegments, uint32_t crc_InitialValue, uint32_t crc_XorValue, bool reflectedOutput, bool reflectedInput);
+
+struct CrcBenchModel
+{
+    const char *name;
+    uint8_t width;
+    uint64_t polynomial;
+    uint64_t initialValue;
+    uint64_t xorValue;
+    bool reflectedInput;
+    bool reflectedOutput;
+};
+
+//AUTOSAR Specification of CRC Routines
+static const CrcBenchModel crcBenchModels[] =
+{
+    { "CRC8",    8,  0x1D,               0xFF,               0xFF,               false, false },
+    { "CRC8H2F", 8,  0x2F,               0xFF,               0xFF,               false, false },
+    { "CRC16",   16, 0x1021,             0xFFFF,             0x0000,             false, false },
+    { "CRC32",   32, 0x04C11DB7,         0xFFFFFFFF,         0xFFFFFFFF,         true,  true  },
+    { "CRC32P4", 32, 0xF4ACFB13,         0xFFFFFFFF,         0xFFFFFFFF,         true,  true  },
+    { "CRC64",   64, 0x42F0E1EBA9EA3693, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, true,  true  },
+    // reflected 16 bit model for the reflected table and slicing kernels, not in AUTOSAR
+    { "MODBUS",  16, 0x8005,             0xFFFF,             0x0000,             true,  true  },
+};
+
+// Start address offsets from a 64 byte boundary
+static const uint32_t crcBenchOffsets[] = { 0, 1, 3, 7 };
+
+struct CrcBenchOptions
+{
+    bool json;
+    const char *model;
+    const char *kernel;
+    uint64_t maxSize;
+    uint64_t bytes;
+    uint32_t messageSize;
+};
+
+// Prevents the compiler from removing CRC calls whose result is not used
+static volatile uint64_t crcBenchSink;
+
+static bool crcBenchFirstRecord = true;
+
+static void CrcBenchBegin(const CrcBenchOptions &options)
+{
+    if (options.json)
+    {
+        printf("[\n");
+    }
+    else
+    {
+        printf("type,model,kernel,size,offset,iterations,ns_per_call,ns_per_byte,gb_per_s\n");
+    }
+}
+
+static void CrcBenchEnd(const CrcBenchOptions &options)
+{
+    if (options.json)
+    {
+        printf("\n]\n");
+    }
+}
+
+static void CrcBenchRecord(const CrcBenchOptions &options, const char *type, const char *model, const char *kernel,
+                           uint64_t size, uint32_t offset, uint64_t iterations, double seconds)
+{
+    double nsPerCall = seconds * 1e9 / (double)iterations;
+    double nsPerByte = (0 != size) ? nsPerCall / (double)size : 0.0;
+    double gbPerSecond = (0.0 != nsPerByte) ? 1.0 / nsPerByte : 0.0;
+
+    if (options.json)
+    {
+        printf("%s  {\"type\": \"%s\", \"model\": \"%s\", \"kernel\": \"%s\", \"size\": %llu, \"offset\": %u, \"iterations\": %llu, "
+               "\"ns_per_call\": %.3f, \"ns_per_byte\": %.4f, \"gb_per_s\": %.4f}",
+               crcBenchFirstRecord ? "" : ",\n", type, model, kernel, (unsigned long long)size, offset,
+               (unsigned long long)iterations, nsPerCall, nsPerByte, gbPerSecond);
+    }
+    else
+    {
+        printf("%s,%s,%s,%llu,%u,%llu,%.3f,%.4f,%.4f\n", type, model, kernel, (unsigned long long)size, offset,
+               (unsigned long long)iterations, nsPerCall, nsPerByte, gbPerSecond);
+    }
+    crcBenchFirstRecord = false;
+    fflush(stdout);
+}
+
+// Seconds for iterations calls, one call before the measurement warms up caches and thread pool
+template <class Call>
+static double CrcBenchTime(Call call, uint64_t iterations)
+{
+    uint64_t sink = call();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        sink += call();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    crcBenchSink = sink;
+    return seconds;
+}
+
+// Tables and constants of one model, generated once per model
+template <class T>
+struct CrcBenchTables
+{
+    T crcTable[256];
+    T crcNibbleTable[16];
+    T crcReflectedTable[256];
+    T crcSlicingTable[16][256];
+    T crcReflectedSlicingTable[16][256];
+    uint64_t clmulConstants[16];
+
+    // messages of the batch and segments kernels, cut again when buffer or size change
+    uint32_t maxMessageSize;
+    const uint8_t *messageBuffer;
+    uint64_t messageBufferSize;
+    std::vector<const uint8_t *> messagePtrs;
+    std::vector<uint32_t> messageLengths;
+    std::vector<CrcSegment> messageSegments;
+    std::vector<T> messageResults;
+};
+
+// Cuts the buffer into messages of 4 to maxMessageSize bytes, the same lengths for every model and kernel
+template <class T>
+static void CrcBenchMessages(CrcBenchTables<T> &tables, const uint8_t *crc_DataPtr, uint64_t crc_Length)
+{
+    uint32_t random = 0x87654321;
+
+    if ((crc_DataPtr == tables.messageBuffer) && (crc_Length == tables.messageBufferSize))
+    {
+        return;
+    }
+
+    tables.messageBuffer = crc_DataPtr;
+    tables.messageBufferSize = crc_Length;
+    tables.messagePtrs.clear();
+    tables.messageLengths.clear();
+    tables.messageSegments.clear();
+    for (uint64_t offset = 0; offset < crc_Length; )
+    {
+        random = random * 1103515245U + 12345U;
+        uint64_t length = 4U + (random >> 8) % (tables.maxMessageSize - 3U);
+        length = (length < crc_Length - offset) ? length : crc_Length - offset;
+
+        tables.messagePtrs.push_back(crc_DataPtr + offset);
+        tables.messageLengths.push_back((uint32_t)length);
+        tables.messageSegments.push_back({ crc_DataPtr + offset, (uint32_t)length });
+        offset += length;
+    }
+    tables.messageResults.resize(tables.messagePtrs.size());
+}
+
+template <class T>
+static void CrcBenchTableGenerator(T polynomial, T crcTable[256])
+{
+    if constexpr (1 == sizeof(T)) { Crc8TableGenerator(polynomial, crcTable); }
+    else if constexpr (2 == sizeof(T)) { Crc16TableGenerator(polynomial, crcTable); }
+    else if constexpr (4 == sizeof(T)) { Crc32TableGenerator(polynomial, crcTable); }
+    else { Crc64TableGenerator(polynomial, crcTable); }
+}
+
+template <class T>
+static void CrcBenchSetup(const CrcBenchOptions &options, const CrcBenchModel &model, CrcBenchTables<T> &tables)
+{
+    T polynomial = (T)model.polynomial;
+    uint64_t iterations = 1000;
+
+    CrcBenchRecord(options, "setup", model.name, "table", 0, 0, iterations, CrcBenchTime([&]()
+    {
+        CrcBenchTableGenerator<T>(polynomial, tables.crcTable);
+        return (uint64_t)tables.crcTable[255];
+    }, iterations));
+
+    CrcBenchRecord(options, "setup", model.name, "nibble", 0, 0, iterations, CrcBenchTime([&]()
+    {
+        if constexpr (1 == sizeof(T)) { Crc8NibbleTableGenerator(polynomial, tables.crcNibbleTable); }
+        else if constexpr (2 == sizeof(T)) { Crc16NibbleTableGenerator(polynomial, tables.crcNibbleTable); }
+        else if constexpr (4 == sizeof(T)) { Crc32NibbleTableGenerator(polynomial, tables.crcNibbleTable); }
+        else { Crc64NibbleTableGenerator(polynomial, tables.crcNibbleTable); }
+        return (uint64_t)tables.crcNibbleTable[15];
+    }, iterations));
+
+    CrcBenchRecord(options, "setup", model.name, "reflected", 0, 0, iterations, CrcBenchTime([&]()
+    {
+        if constexpr (1 == sizeof(T)) { Crc8ReflectedTableGenerator(polynomial, tables.crcReflectedTable); }
+        else if constexpr (2 == sizeof(T)) { Crc16ReflectedTableGenerator(polynomial, tables.crcReflectedTable); }
+        else if constexpr (4 == sizeof(T)) { Crc32ReflectedTableGenerator(polynomial, tables.crcReflectedTable); }
+        else { Crc64ReflectedTableGenerator(polynomial, tables.crcReflectedTable); }
+        return (uint64_t)tables.crcReflectedTable[255];
+    }, iterations));
+
+    if constexpr (sizeof(T) >= 2)
+    {
+        CrcBenchRecord(options, "setup", model.name, "slicing16", 0, 0, iterations / 10, CrcBenchTime([&]()
+        {
+            if constexpr (2 == sizeof(T)) { Crc16SlicingTableGenerator(polynomial, tables.crcSlicingTable, 16); }
+            else if constexpr (4 == sizeof(T)) { Crc32SlicingTableGenerator(polynomial, tables.crcSlicingTable, 16); }
+            else { Crc64SlicingTableGenerator(polynomial, tables.crcSlicingTable, 16); }
+            return (uint64_t)tables.crcSlicingTable[15][255];
+        }, iterations / 10));
+    }
+
+    if constexpr (sizeof(T) >= 2)
+    {
+        CrcBenchRecord(options, "setup", model.name, "reflected-slicing16", 0, 0, iterations / 10, CrcBenchTime([&]()
+        {
+            if constexpr (2 == sizeof(T)) { Crc16ReflectedSlicingTableGenerator(polynomial, tables.crcReflectedSlicingTable, 16); }
+            else if constexpr (4 == sizeof(T)) { Crc32ReflectedSlicingTableGenerator(polynomial, tables.crcReflectedSlicingTable, 16); }
+            else { Crc64ReflectedSlicingTableGenerator(polynomial, tables.crcReflectedSlicingTable, 16); }
+            return (uint64_t)tables.crcReflectedSlicingTable[15][255];
+        }, iterations / 10));
+    }
+
+    CrcBenchRecord(options, "setup", model.name, "clmul", 0, 0, iterations / 10, CrcBenchTime([&]()
+    {
+        CrcClmulConstantsGenerator(model.polynomial, model.width, tables.clmulConstants);
+        return tables.clmulConstants[0];
+    }, iterations / 10));
+}
+
+enum CrcBenchKernelId
+{
+    CRC_BENCH_BITWISE,
+    CRC_BENCH_NIBBLE,
+    CRC_BENCH_TABLE,
+    CRC_BENCH_REFLECTED,
+    CRC_BENCH_SLICING8,
+    CRC_BENCH_SLICING16,
+    CRC_BENCH_CLMUL,
+    CRC_BENCH_PARALLEL,
+    CRC_BENCH_BATCH,
+    CRC_BENCH_BATCH_LOOP,
+    CRC_BENCH_SEGMENTS,
+    CRC_BENCH_KERNELS
+};
+
+static const char *const crcBenchKernels[CRC_BENCH_KERNELS] = { "bitwise", "nibble", "table", "reflected", "slicing8", "slicing16", "clmul", "parallel", "batch", "batch-loop", "segments" };
+
+// Calls kernel for the buffer, returns false if the kernel does not exist for this width or model
+template <class T>
+static bool CrcBenchKernel(CrcBenchKernelId kernel, const CrcBenchModel &model, CrcBenchTables<T> &tables,
+                           const uint8_t *crc_DataPtr, uint64_t crc_Length, uint64_t &crc)
+{
+    T init = (T)model.initialValue;
+    T xorValue = (T)model.xorValue;
+    bool refIn = model.reflectedInput;
+    bool refOut = model.reflectedOutput;
+    uint32_t length = (uint32_t)crc_Length;
+
+    if (CRC_BENCH_BITWISE == kernel)
+    {
+        T polynomial = (T)model.polynomial;
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8Bitwise(polynomial, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Bitwise(polynomial, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Bitwise(polynomial, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else { crc = CalculateCRC64Bitwise(polynomial, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        return true;
+    }
+    if (CRC_BENCH_NIBBLE == kernel)
+    {
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8Nibble(tables.crcNibbleTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Nibble(tables.crcNibbleTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Nibble(tables.crcNibbleTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else { crc = CalculateCRC64Nibble(tables.crcNibbleTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        return true;
+    }
+    if (CRC_BENCH_TABLE == kernel)
+    {
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8(tables.crcTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16(tables.crcTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32(tables.crcTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else { crc = CalculateCRC64(tables.crcTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        return true;
+    }
+    if (CRC_BENCH_REFLECTED == kernel)
+    {
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8Reflected(tables.crcReflectedTable, crc_DataPtr, length, init, xorValue, refOut); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Reflected(tables.crcReflectedTable, crc_DataPtr, length, init, xorValue, refOut); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Reflected(tables.crcReflectedTable, crc_DataPtr, length, init, xorValue, refOut); }
+        else { crc = CalculateCRC64Reflected(tables.crcReflectedTable, crc_DataPtr, length, init, xorValue, refOut); }
+        return refIn;
+    }
+    if (CRC_BENCH_SLICING8 == kernel)
+    {
+        // reflected input models slice with reflected tables, like the reflected kernel
+        if constexpr (2 == sizeof(T)) { if (refIn) { crc = CalculateCRC16ReflectedSlicing8(tables.crcReflectedSlicingTable, crc_DataPtr, length, init, xorValue, refOut); return true; } }
+        else if constexpr (4 == sizeof(T)) { if (refIn) { crc = CalculateCRC32ReflectedSlicing8(tables.crcReflectedSlicingTable, crc_DataPtr, length, init, xorValue, refOut); return true; } }
+        else if constexpr (8 == sizeof(T)) { if (refIn) { crc = CalculateCRC64ReflectedSlicing8(tables.crcReflectedSlicingTable, crc_DataPtr, length, init, xorValue, refOut); return true; } }
+        if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Slicing8(tables.crcSlicingTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Slicing8(tables.crcSlicingTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (8 == sizeof(T)) { crc = CalculateCRC64Slicing8(tables.crcSlicingTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else { return false; }
+        return true;
+    }
+    if (CRC_BENCH_SLICING16 == kernel)
+    {
+        if constexpr (2 == sizeof(T)) { if (refIn) { crc = CalculateCRC16ReflectedSlicing16(tables.crcReflectedSlicingTable, crc_DataPtr, length, init, xorValue, refOut); return true; } }
+        else if constexpr (4 == sizeof(T)) { if (refIn) { crc = CalculateCRC32ReflectedSlicing16(tables.crcReflectedSlicingTable, crc_DataPtr, length, init, xorValue, refOut); return true; } }
+        else if constexpr (8 == sizeof(T)) { if (refIn) { crc = CalculateCRC64ReflectedSlicing16(tables.crcReflectedSlicingTable, crc_DataPtr, length, init, xorValue, refOut); return true; } }
+        if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Slicing16(tables.crcSlicingTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Slicing16(tables.crcSlicingTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (8 == sizeof(T)) { crc = CalculateCRC64Slicing16(tables.crcSlicingTable, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else { return false; }
+        return true;
+    }
+    if (CRC_BENCH_CLMUL == kernel)
+    {
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8Clmul(tables.crcTable, tables.clmulConstants, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Clmul(tables.crcTable, tables.clmulConstants, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Clmul(tables.crcTable, tables.clmulConstants, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        else { crc = CalculateCRC64Clmul(tables.crcTable, tables.clmulConstants, crc_DataPtr, length, init, xorValue, refOut, refIn); }
+        return true;
+    }
+    if (CRC_BENCH_PARALLEL == kernel)
+    {
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8Parallel(tables.crcTable, tables.clmulConstants, crc_DataPtr, crc_Length, init, xorValue, refOut, refIn); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Parallel(tables.crcTable, tables.clmulConstants, crc_DataPtr, crc_Length, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Parallel(tables.crcTable, tables.clmulConstants, crc_DataPtr, crc_Length, init, xorValue, refOut, refIn); }
+        else { return false; }
+        return true;
+    }
+    if (CRC_BENCH_BATCH == kernel)
+    {
+        CrcBenchMessages<T>(tables, crc_DataPtr, crc_Length);
+        uint32_t nMessages = (uint32_t)tables.messagePtrs.size();
+        const uint8_t *const *crc_DataPtrs = tables.messagePtrs.data();
+        const uint32_t *crc_Lengths = tables.messageLengths.data();
+
+        if constexpr (1 == sizeof(T)) { CalculateCRC8Batch(tables.crcTable, crc_DataPtrs, crc_Lengths, nMessages, init, xorValue, refOut, refIn, tables.messageResults.data()); }
+        else if constexpr (2 == sizeof(T)) { CalculateCRC16Batch(tables.crcTable, crc_DataPtrs, crc_Lengths, nMessages, init, xorValue, refOut, refIn, tables.messageResults.data()); }
+        else if constexpr (4 == sizeof(T)) { CalculateCRC32Batch(tables.crcTable, crc_DataPtrs, crc_Lengths, nMessages, init, xorValue, refOut, refIn, tables.messageResults.data()); }
+        else { return false; }
+        crc = (0 != nMessages) ? tables.messageResults[nMessages - 1] : 0;
+        return true;
+    }
+    if (CRC_BENCH_BATCH_LOOP == kernel)
+    {
+        // reference for the batch kernel: the same messages one call each
+        if (8 == sizeof(T))
+        {
+            return false;
+        }
+        CrcBenchMessages<T>(tables, crc_DataPtr, crc_Length);
+        uint32_t nMessages = (uint32_t)tables.messagePtrs.size();
+
+        for (uint32_t message = 0; message < nMessages; message++)
+        {
+            const uint8_t *messagePtr = tables.messagePtrs[message];
+            uint32_t messageLength = tables.messageLengths[message];
+
+            if constexpr (1 == sizeof(T)) { tables.messageResults[message] = CalculateCRC8(tables.crcTable, messagePtr, messageLength, init, xorValue, refOut, refIn); }
+            else if constexpr (2 == sizeof(T)) { tables.messageResults[message] = CalculateCRC16(tables.crcTable, messagePtr, messageLength, init, xorValue, refOut, refIn); }
+            else if constexpr (4 == sizeof(T)) { tables.messageResults[message] = CalculateCRC32(tables.crcTable, messagePtr, messageLength, init, xorValue, refOut, refIn); }
+        }
+        crc = (0 != nMessages) ? tables.messageResults[nMessages - 1] : 0;
+        return true;
+    }
+    if (CRC_BENCH_SEGMENTS == kernel)
+    {
+        CrcBenchMessages<T>(tables, crc_DataPtr, crc_Length);
+        uint32_t nSegments = (uint32_t)tables.messageSegments.size();
+        const CrcSegment *crc_Segments = tables.messageSegments.data();
+
+        if constexpr (1 == sizeof(T)) { crc = CalculateCRC8Segments(tables.crcTable, tables.clmulConstants, crc_Segments, nSegments, init, xorValue, refOut, refIn); }
+        else if constexpr (2 == sizeof(T)) { crc = CalculateCRC16Segments(tables.crcTable, tables.clmulConstants, crc_Segments, nSegments, init, xorValue, refOut, refIn); }
+        else if constexpr (4 == sizeof(T)) { crc = CalculateCRC32Segments(tables.crcTable, tables.clmulConstants, crc_Segments, nSegments, init, xorValue, refOut, refIn); }
+        else { return false; }
+        return true;
+    }
+    return false;
+}
+
+template <class T>
+static void CrcBenchModelRun(const CrcBenchOptions &options, const CrcBenchModel &model, const uint8_t *buffer)
+{
+    CrcBenchTables<T> *tables = new CrcBenchTables<T>();
+
+    tables->maxMessageSize = options.messageSize;
+
+    CrcBenchSetup<T>(options, model, *tables);
+
+    for (uint32_t id = 0; id < CRC_BENCH_KERNELS; id++)
+    {
+        CrcBenchKernelId kernel = (CrcBenchKernelId)id;
+        uint64_t crc = 0;
+
+        if (((nullptr != options.kernel) && (0 != strcmp(options.kernel, crcBenchKernels[id]))) || !CrcBenchKernel<T>(kernel, model, *tables, buffer, 0, crc))
+        {
+            continue;
+        }
+
+        // bit and nibble kernels are capped unless they were asked for
+        uint64_t maxSize = options.maxSize;
+        uint64_t bytes = options.bytes;
+        if ((nullptr == options.kernel) && ((CRC_BENCH_BITWISE == kernel) || (CRC_BENCH_NIBBLE == kernel)))
+        {
+            maxSize = (maxSize < CRC_BENCH_BITWISE_SIZE) ? maxSize : CRC_BENCH_BITWISE_SIZE;
+            bytes = (bytes < CRC_BENCH_BITWISE_SIZE) ? bytes : CRC_BENCH_BITWISE_SIZE;
+        }
+
+        // 1, 4, 16, ... bytes
+        for (uint64_t size = 1; size <= maxSize; size *= 4)
+        {
+            uint64_t iterations = (size < bytes) ? bytes / size : 1;
+
+            for (uint32_t offset : crcBenchOffsets)
+            {
+                const uint8_t *crc_DataPtr = buffer + offset;
+
+                double seconds = CrcBenchTime([&]()
+                {
+                    CrcBenchKernel<T>(kernel, model, *tables, crc_DataPtr, size, crc);
+                    return crc;
+                }, iterations);
+
+                CrcBenchRecord(options, "crc", model.name, crcBenchKernels[id], size, offset, iterations, seconds);
+            }
+        }
+    }
+
+    delete tables;
+}
+
+int main(int argc, char *argv[])
+{
+    CrcBenchOptions options = { false, nullptr, nullptr, CRC_BENCH_MAX_SIZE, CRC_BENCH_BYTES, CRC_BENCH_MESSAGE_SIZE };
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "--json"))
+        {
+            options.json = true;
+        }
+        else if ((0 == strcmp(argv[i], "--model")) && (i + 1 < argc))
+        {
+            options.model = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "--kernel")) && (i + 1 < argc))
+        {
+            options.kernel = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "--max-size")) && (i + 1 < argc))
+        {
+            options.maxSize = strtoull(argv[++i], nullptr, 0);
+        }
+        else if ((0 == strcmp(argv[i], "--bytes")) && (i + 1 < argc))
+        {
+            options.bytes = strtoull(argv[++i], nullptr, 0);
+        }
+        else if ((0 == strcmp(argv[i], "--message-size")) && (i + 1 < argc))
+        {
+            options.messageSize = (uint32_t)strtoul(argv[++i], nullptr, 0);
+        }
+        else
+        {
+            fprintf(stderr, "Usage: %s [--json] [--model NAME] [--kernel NAME] [--max-size BYTES] [--bytes BYTES] [--message-size BYTES]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if ((0 == options.maxSize) || (options.maxSize > 0xFFFFFFFFULL - 64U))
+    {
+        fprintf(stderr, "--max-size has to be between 1 and 4 GB\n");
+        return 2;
+    }
+
+    if (options.messageSize < 4U)
+    {
+        fprintf(stderr, "--message-size has to be at least 4 bytes\n");
+        return 2;
+    }
+
+    // 64 byte aligned buffer with room for the largest offset
+    std::vector<uint8_t> storage(options.maxSize + 128U);
+    uint8_t *buffer = storage.data() + ((64U - ((uintptr_t)storage.data() & 63U)) & 63U);
+    uint32_t random = 0x12345678;
+    for (size_t i = 0; i < storage.size(); i++)
+    {
+        random = random * 1103515245U + 12345U;
+        storage[i] = (uint8_t)(random >> 16);
+    }
+
+    CrcBenchBegin(options);
+    for (const CrcBenchModel &model : crcBenchModels)
+    {
+        if ((nullptr != options.model) && (0 != strcmp(options.model, model.name)))
+        {
+            continue;
+        }
+
+        switch (model.width)
+        {
+            case 8:  CrcBenchModelRun<uint8_t>(options, model, buffer); break;
+            case 16: CrcBenchModelRun<uint16_t>(options, model, buffer); break;
+            case 32: CrcBenchModelRun<uint32_t>(options, model, buffer); break;
+            default: CrcBenchModelRun<uint64_t>(options, model, buffer); break;
+        }
+    }
+    CrcBenchEnd(options);
+
+#ifdef CRC_STATS
+    CrcStatsDump(stderr);
+#endif
+
+    return 0;
+}
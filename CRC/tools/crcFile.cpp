@@ -0,0 +1,227 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../crcRegistry.h"
+
+//CRC of a file with one of the models from crcRegistry.h.
+//Regular files are mapped window by window with mmap(), pipes and other streams are read by a second thread into
+//two buffers, so read() of the next buffer runs while the CRC of the previous one is calculated. Memory use does
+//not depend on the file size in both cases.
+//
+//Build:
+//    g++ -std=c++17 -O2 -pthread CRC/tools/crcFile.cpp CRC/crc8.cpp CRC/crc16.cpp CRC/crc32.cpp CRC/crc64.cpp
+//        CRC/crcClmul.cpp CRC/crcRegistry.cpp CRC/reflect.cpp -o crcFile
+//Usage:
+//    crcFile <file | -> [model]
+//
+//Model is a catalogue name (e.g. CRC-32/ISO-HDLC) or AUTOSAR name (CRC8, CRC8H2F, CRC16, CRC32, CRC32P4, CRC64),
+//default is CRC32.
+
+// Mapped part of a regular file, multiple of the page size
+#define CRC_FILE_WINDOW     (64U * 1024U * 1024U)
+
+// Size of each of the two pipe buffers
+#define CRC_FILE_BUFFER     (1024U * 1024U)
+
+// Running CRC of the file. Register is kept without xor and output reflection between the parts.
+struct CrcFileState
+{
+    const CrcRegisteredModel *model;
+    uint64_t crc;
+    uint64_t length;
+};
+
+static void CrcFileUpdate(CrcFileState &state, const uint8_t *crc_DataPtr, uint32_t crc_Length)
+{
+    state.crc = state.model->Update(state.crc, crc_DataPtr, crc_Length);
+    state.length += crc_Length;
+}
+
+// Regular file, mapped one window at a time so only one window is mapped at once
+static bool CrcFileMapped(CrcFileState &state, int fd, uint64_t fileSize)
+{
+    for (uint64_t offset = 0; offset < fileSize; offset += CRC_FILE_WINDOW)
+    {
+        size_t windowLength = (fileSize - offset < CRC_FILE_WINDOW) ? (size_t)(fileSize - offset) : CRC_FILE_WINDOW;
+        void *window = mmap(nullptr, windowLength, PROT_READ, MAP_PRIVATE, fd, (off_t)offset);
+
+        if (MAP_FAILED == window)
+        {
+            return false;
+        }
+        madvise(window, windowLength, MADV_SEQUENTIAL);
+
+        CrcFileUpdate(state, (const uint8_t *)window, (uint32_t)windowLength);
+        munmap(window, windowLength);
+    }
+
+    return true;
+}
+
+// Two buffers between the reader thread and the CRC calculation
+struct CrcFilePipe
+{
+    std::vector<uint8_t> buffer[2];
+    size_t length[2];
+    bool full[2];
+    bool error;                 // sticky, set by the first failed read()
+    int errorNumber;            // errno of the reader thread
+    std::mutex lock;
+    std::condition_variable changed;
+};
+
+static void CrcFileReader(CrcFilePipe &pipe, int fd)
+{
+    for (uint32_t index = 0; ; index ^= 1U)
+    {
+        {
+            std::unique_lock<std::mutex> guard(pipe.lock);
+            pipe.changed.wait(guard, [&]() { return !pipe.full[index]; });
+        }
+
+        size_t length = 0;
+        bool error = false;
+        while (length < CRC_FILE_BUFFER)
+        {
+            ssize_t nRead = read(fd, pipe.buffer[index].data() + length, CRC_FILE_BUFFER - length);
+            if (nRead > 0)
+            {
+                length += (size_t)nRead;
+            }
+            else if ((nRead < 0) && (EINTR == errno))
+            {
+                continue;
+            }
+            else
+            {
+                error = (nRead < 0);
+                break;
+            }
+        }
+
+        // after an error the data is incomplete, the empty buffer ends the stream at once
+        {
+            std::lock_guard<std::mutex> guard(pipe.lock);
+            pipe.length[index] = error ? 0 : length;
+            pipe.full[index] = true;
+            pipe.errorNumber = (error && !pipe.error) ? errno : pipe.errorNumber;
+            pipe.error = pipe.error || error;
+        }
+        pipe.changed.notify_one();
+
+        // empty buffer marks the end of the stream
+        if (error || (0 == length))
+        {
+            return;
+        }
+    }
+}
+
+// Pipe or other stream, read() of one buffer overlaps the CRC of the other one
+static bool CrcFileStream(CrcFileState &state, int fd)
+{
+    CrcFilePipe pipe;
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        pipe.buffer[i].resize(CRC_FILE_BUFFER);
+        pipe.length[i] = 0;
+        pipe.full[i] = false;
+    }
+    pipe.error = false;
+    pipe.errorNumber = 0;
+
+    std::thread reader(CrcFileReader, std::ref(pipe), fd);
+
+    for (uint32_t index = 0; ; index ^= 1U)
+    {
+        size_t length;
+        {
+            std::unique_lock<std::mutex> guard(pipe.lock);
+            pipe.changed.wait(guard, [&]() { return pipe.full[index]; });
+            length = pipe.length[index];
+        }
+
+        if (0 == length)
+        {
+            break;
+        }
+        CrcFileUpdate(state, pipe.buffer[index].data(), (uint32_t)length);
+
+        {
+            std::lock_guard<std::mutex> guard(pipe.lock);
+            pipe.full[index] = false;
+        }
+        pipe.changed.notify_one();
+    }
+
+    reader.join();
+    errno = pipe.errorNumber;
+    return !pipe.error;
+}
+
+int main(int argc, char *argv[])
+{
+    if ((argc < 2) || (argc > 3))
+    {
+        fprintf(stderr, "Usage: %s <file | -> [model]\n", argv[0]);
+        return 2;
+    }
+
+    const CrcRegisteredModel *model = CrcFindModel((3 == argc) ? argv[2] : "CRC32");
+    if (nullptr == model)
+    {
+        fprintf(stderr, "Unknown CRC model %s\n", argv[2]);
+        return 2;
+    }
+
+    int fd = (0 == strcmp(argv[1], "-")) ? STDIN_FILENO : open(argv[1], O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "Cannot open %s: %s\n", argv[1], strerror(errno));
+        return 1;
+    }
+
+    CrcFileState state = { model, model->Start(), 0 };
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    struct stat fileStat;
+    bool ok;
+    if ((0 == fstat(fd, &fileStat)) && S_ISREG(fileStat.st_mode) && CrcFileMapped(state, fd, (uint64_t)fileStat.st_size))
+    {
+        ok = true;
+    }
+    else
+    {
+        // mapping can fail after some windows, continue from there with read()
+        ok = (0 == state.length) || ((off_t)state.length == lseek(fd, (off_t)state.length, SEEK_SET));
+        ok = ok && CrcFileStream(state, fd);
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!ok)
+    {
+        fprintf(stderr, "Read error in %s: %s\n", argv[1], strerror(errno));
+        close(fd);
+        return 1;
+    }
+    close(fd);
+
+    printf("%s 0x%0*llx %s\n", model->parameters.name, (model->parameters.width + 3) / 4, (unsigned long long)model->Finalize(state.crc), argv[1]);
+    fprintf(stderr, "%llu bytes in %.3f s, %.1f MB/s\n", (unsigned long long)state.length, seconds,
+            (seconds > 0.0) ? (double)state.length / seconds / 1e6 : 0.0);
+
+    return 0;
+}
@@ -0,0 +1,612 @@
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+
+#include "../crcKernel.h"
+#include "../crcRegistry.h"
+
+//Source generator for targets without table generation at startup: emits one C/C++ source with the lookup tables of
+//a model as const arrays (ROM) and a compute function specialized for its width, polynomial, initial and xor value
+//and reflection, with the AUTOSAR Crc_CalculateCRCxx() signature. Optionally a test which compares the generated
+//function with CalculateCRC() of crcKernel.h for many lengths, offsets and split calls.
+//
+//Build:
+//    g++ -std=c++17 -O2 -pthread CRC/tools/crcGenerate.cpp CRC/crcRegistry.cpp CRC/crc8.cpp CRC/crc16.cpp CRC/crc32.cpp
+//        CRC/crc64.cpp CRC/crcClmul.cpp CRC/reflect.cpp -o crcGenerate
+//Usage:
+//    crcGenerate (--model NAME | --width W --poly P [--init I] [--xor X] [--refin] [--refout])
+//                [--kernel bitwise|nibble|byte|slicingN] [--name FUNCTION] --output FILE [--test FILE]
+//
+//Values are hex. Kernels and their table size: bitwise none, nibble 16 entries, byte 256 entries, slicingN (N = 2..16)
+//N * 256 entries and N bytes per step. Reflected models use reflected tables, so no byte is reflected at run time.
+//The generated test is built with the generated source and the CRC directory as include path:
+//    g++ -std=c++17 -ICRC crc32IsoHdlc.c crc32IsoHdlcTest.cpp -o crc32IsoHdlcTest
+
+#define CRC_GENERATE_MAX_SLICES     16U
+
+enum CrcGenerateKernel
+{
+    CRC_GENERATE_BITWISE,
+    CRC_GENERATE_NIBBLE,
+    CRC_GENERATE_BYTE,
+    CRC_GENERATE_SLICING
+};
+
+struct CrcGenerateOptions
+{
+    CrcModelParameters parameters;
+    CrcGenerateKernel kernel;
+    uint8_t nSlices;
+    std::string name;
+};
+
+static std::string CrcGenerateFormat(const char *format, ...)
+{
+    char buffer[256];
+    va_list arguments;
+
+    va_start(arguments, format);
+    vsnprintf(buffer, sizeof(buffer), format, arguments);
+    va_end(arguments);
+    return buffer;
+}
+
+// "CRC-32/ISO-HDLC" to "Crc32IsoHdlc"
+static std::string CrcGenerateFunctionName(const char *modelName)
+{
+    std::string name;
+    bool wordStart = true;
+
+    for (const char *c = modelName; '\0' != *c; c++)
+    {
+        if (!isalnum((unsigned char)*c))
+        {
+            wordStart = true;
+            continue;
+        }
+        name += (char)(wordStart ? toupper((unsigned char)*c) : tolower((unsigned char)*c));
+        wordStart = false;
+    }
+    return name;
+}
+
+template <class T>
+class CrcGenerator
+{
+public:
+    CrcGenerator(const CrcGenerateOptions &generateOptions) : options(generateOptions), parameters(generateOptions.parameters)
+    {
+        width = parameters.width;
+        typeWidth = 8*sizeof(T);
+        shift = typeWidth - width;
+        type = CrcGenerateFormat("uint%u_t", typeWidth);
+        name = options.name.c_str();
+
+        T polynomial = (T)parameters.polynomial;
+        std::vector<T> table(256);
+
+        if (CRC_GENERATE_NIBBLE == options.kernel)
+        {
+            tables.assign(1, std::vector<T>(16));
+            if (parameters.reflectedInput)
+            {
+                CrcReflectedNibbleTableGenerator<T>(polynomial, tables[0].data(), width);
+            }
+            else
+            {
+                CrcNibbleTableGenerator<T>(polynomial, tables[0].data(), width);
+            }
+        }
+        else if (CRC_GENERATE_BITWISE != options.kernel)
+        {
+            uint8_t nSlices = (CRC_GENERATE_SLICING == options.kernel) ? options.nSlices : 1;
+
+            if (parameters.reflectedInput)
+            {
+                CrcReflectedTableGenerator<T>(polynomial, table.data(), width);
+            }
+            else
+            {
+                CrcTableGenerator<T>(polynomial, table.data(), width);
+            }
+
+            // tables[k][d] is the CRC of byte d followed by k zero bytes, same as CrcSlicingTableGenerator()
+            tables.assign(nSlices, table);
+            for (uint8_t slice = 1; slice < nSlices; slice++)
+            {
+                for (uint32_t dividend = 0; dividend < 256; dividend++)
+                {
+                    T previous = tables[slice - 1][dividend];
+                    tables[slice][dividend] = parameters.reflectedInput ? (T)((previous >> 8) ^ table[(uint8_t)previous])
+                                                                        : (T)(CrcShiftLeft(previous, 8) ^ table[(uint8_t)(previous >> (typeWidth - 8))]);
+                }
+            }
+        }
+    }
+
+    // CRC of "123456789" by CalculateCRC()
+    T Check() const
+    {
+        T table[256];
+        CrcTableGenerator<T>((T)parameters.polynomial, table, width);
+        return CalculateCRC<T>(table, (const uint8_t *)"123456789", 9, (T)parameters.initialValue, (T)parameters.xorValue, parameters.reflectedOutput,
+                               parameters.reflectedInput, width);
+    }
+
+    void Source(FILE *file) const
+    {
+        bool reflect = (parameters.reflectedInput != parameters.reflectedOutput);
+
+        fprintf(file, "// Generated by crcGenerate, do not edit.\n");
+        Description(file);
+        fprintf(file, "\n#include <stdbool.h>\n#include <stdint.h>\n\n");
+        fprintf(file, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+        fprintf(file, "%s;\n\n", Prototype().c_str());
+
+        Tables(file);
+
+        if (reflect)
+        {
+            fprintf(file, "// Reflects the %u bit CRC\n", width);
+            fprintf(file, "static %s %sReflect(%s value)\n{\n", type.c_str(), name, type.c_str());
+            fprintf(file, "    %s reflected = 0U;\n\n", type.c_str());
+            fprintf(file, "    for (uint8_t bit = 0U; bit < %uU; bit++)\n    {\n", width);
+            fprintf(file, "        reflected = (%s)((reflected << 1) | ((value >> bit) & 1U));\n    }\n", type.c_str());
+            fprintf(file, "    return reflected;\n}\n\n");
+        }
+
+        fprintf(file, "// First call with crc_IsFirstCall = true, further calls with the result of the previous call as start value\n");
+        fprintf(file, "%s\n{\n", Prototype().c_str());
+        fprintf(file, "    %s crc;\n\n", type.c_str());
+        Start(file);
+        fprintf(file, "\n");
+        Kernel(file);
+        fprintf(file, "\n");
+        Finalize(file);
+        fprintf(file, "}\n\n");
+
+        fprintf(file, "#ifdef __cplusplus\n}\n#endif\n");
+    }
+
+    void Test(FILE *file) const
+    {
+        fprintf(file, "// Generated by crcGenerate, do not edit.\n");
+        fprintf(file, "// %s() against CalculateCRC() of crcKernel.h: check value, lengths 0..1100 at offsets 0..7 and split calls.\n", name);
+        fprintf(file, "\n#include <stdint.h>\n#include <stdio.h>\n\n#include \"crcKernel.h\"\n\n");
+        fprintf(file, "extern \"C\" %s;\n\n", Prototype().c_str());
+
+        fprintf(file, "int main()\n{\n");
+        fprintf(file, "    %s crcTable[256];\n", type.c_str());
+        fprintf(file, "    uint8_t data[1100 + 8];\n");
+        fprintf(file, "    uint32_t failures = 0;\n\n");
+        fprintf(file, "    CrcTableGenerator<%s>(%s, crcTable, %u);\n", type.c_str(), Hex(parameters.polynomial).c_str(), width);
+        fprintf(file, "    for (uint32_t i = 0; i < sizeof(data); i++)\n    {\n");
+        fprintf(file, "        data[i] = (uint8_t)((i * 2654435761U) >> 24);\n    }\n\n");
+
+        fprintf(file, "    if (%s((const uint8_t *)\"123456789\", 9U, 0U, true) != %s)\n    {\n", name, Hex(Check()).c_str());
+        fprintf(file, "        printf(\"Error for %s check value\\n\");\n", name);
+        fprintf(file, "        failures++;\n    }\n\n");
+
+        fprintf(file, "    for (uint32_t offset = 0; offset < 8; offset++)\n    {\n");
+        fprintf(file, "        for (uint32_t length = 0; length <= 1100; length++)\n        {\n");
+        fprintf(file, "            %s expected = CalculateCRC<%s>(crcTable, data + offset, length, %s, %s, %s, %s, %u);\n", type.c_str(), type.c_str(),
+                Hex(parameters.initialValue).c_str(), Hex(parameters.xorValue).c_str(), parameters.reflectedOutput ? "true" : "false",
+                parameters.reflectedInput ? "true" : "false", width);
+        fprintf(file, "            uint32_t split = length / 3;\n");
+        fprintf(file, "            %s crc = %s(data + offset, split, 0U, true);\n\n", type.c_str(), name);
+        fprintf(file, "            crc = %s(data + offset + split, length - split, crc, false);\n", name);
+        fprintf(file, "            if ((%s(data + offset, length, 0U, true) != expected) || (crc != expected))\n            {\n", name);
+        fprintf(file, "                printf(\"Error for %s length %%u offset %%u\\n\", length, offset);\n", name);
+        fprintf(file, "                failures++;\n            }\n        }\n    }\n\n");
+
+        fprintf(file, "    if (0 == failures)\n    {\n        printf(\"%s OK!\\n\");\n    }\n", name);
+        fprintf(file, "    return (0 == failures) ? 0 : 1;\n}\n");
+    }
+
+private:
+    static T CrcShiftLeft(T value, uint32_t bits)
+    {
+        return (bits >= 8*sizeof(T)) ? (T)0 : (T)((uint64_t)value << bits);
+    }
+
+    std::string Hex(uint64_t value) const
+    {
+        return CrcGenerateFormat("0x%0*llX%s", typeWidth / 4, (unsigned long long)(T)value, (64 == typeWidth) ? "ULL" : "U");
+    }
+
+    std::string Prototype() const
+    {
+        return CrcGenerateFormat("%s %s(const uint8_t *crc_DataPtr, uint32_t crc_Length, %s crc_StartValue, bool crc_IsFirstCall)", type.c_str(), name, type.c_str());
+    }
+
+    std::string TableName() const
+    {
+        return options.name + "Table";
+    }
+
+    void Description(FILE *file) const
+    {
+        static const char *const kernelNames[] = {"bitwise", "nibble", "byte"};
+
+        int digits = (int)(width + 3) / 4;
+        fprintf(file, "// %s: width %u, polynomial 0x%0*llX, init 0x%0*llX, xor 0x%0*llX, refin %s, refout %s, check 0x%0*llX\n",
+                (nullptr != parameters.name) ? parameters.name : "custom model", width, digits, (unsigned long long)parameters.polynomial,
+                digits, (unsigned long long)parameters.initialValue, digits, (unsigned long long)parameters.xorValue, parameters.reflectedInput ? "true" : "false",
+                parameters.reflectedOutput ? "true" : "false", digits, (unsigned long long)Check());
+
+        size_t tableBytes = tables.empty() ? 0 : tables.size() * tables[0].size() * sizeof(T);
+        if (CRC_GENERATE_SLICING == options.kernel)
+        {
+            fprintf(file, "// Kernel: slicing-by-%u, %zu bytes of tables\n", options.nSlices, tableBytes);
+        }
+        else
+        {
+            fprintf(file, "// Kernel: %s, %zu bytes of tables\n", kernelNames[options.kernel], tableBytes);
+        }
+    }
+
+    void Tables(FILE *file) const
+    {
+        if (tables.empty())
+        {
+            return;
+        }
+
+        bool sliced = (CRC_GENERATE_SLICING == options.kernel);
+        uint32_t perLine = (64 == typeWidth) ? 4 : 8;
+        const char *indent = sliced ? "        " : "    ";
+
+        if (sliced)
+        {
+            fprintf(file, "// %s[k][d] is the CRC of byte d followed by k zero bytes\n", TableName().c_str());
+        }
+        fprintf(file, "static const %s %s", type.c_str(), TableName().c_str());
+        if (sliced)
+        {
+            fprintf(file, "[%zu]", tables.size());
+        }
+        fprintf(file, "[%zu] =\n{\n", tables[0].size());
+
+        for (size_t slice = 0; slice < tables.size(); slice++)
+        {
+            if (sliced)
+            {
+                fprintf(file, "    {\n");
+            }
+            for (size_t i = 0; i < tables[slice].size(); i++)
+            {
+                fprintf(file, "%s%s%s", (0 == i % perLine) ? indent : " ", Hex(tables[slice][i]).c_str(), (i + 1 < tables[slice].size()) ? "," : "");
+                if ((0 == (i + 1) % perLine) || (i + 1 == tables[slice].size()))
+                {
+                    fprintf(file, "\n");
+                }
+            }
+            if (sliced)
+            {
+                fprintf(file, "    }%s\n", (slice + 1 < tables.size()) ? "," : "");
+            }
+        }
+        fprintf(file, "};\n\n");
+    }
+
+    // Register value from the initial value or the previous result. The register is reflected (low bits) for
+    // reflected input, left aligned in the type otherwise.
+    void Start(FILE *file) const
+    {
+        T init = parameters.reflectedInput ? (T)CrcReflectValue(parameters.initialValue, width) : CrcShiftLeft((T)parameters.initialValue, shift);
+        std::string restart;
+
+        if (parameters.reflectedInput)
+        {
+            restart = parameters.reflectedOutput ? CrcGenerateFormat("(%s)(crc_StartValue ^ %s)", type.c_str(), Hex(CrcReflectValue(parameters.xorValue, width)).c_str())
+                                                 : CrcGenerateFormat("%sReflect((%s)(crc_StartValue ^ %s))", name, type.c_str(), Hex(parameters.xorValue).c_str());
+        }
+        else
+        {
+            std::string value = parameters.reflectedOutput ? CrcGenerateFormat("(%sReflect(crc_StartValue) ^ %s)", name, Hex(parameters.xorValue).c_str())
+                                                           : CrcGenerateFormat("(crc_StartValue ^ %s)", Hex(parameters.xorValue).c_str());
+            restart = (0 == shift) ? CrcGenerateFormat("(%s)%s", type.c_str(), value.c_str()) : CrcGenerateFormat("(%s)(%s << %u)", type.c_str(), value.c_str(), shift);
+        }
+
+        fprintf(file, "    if (crc_IsFirstCall)\n    {\n        crc = %s;\n    }\n", Hex(init).c_str());
+        fprintf(file, "    else\n    {\n        crc = %s;\n    }\n", restart.c_str());
+    }
+
+    void Finalize(FILE *file) const
+    {
+        std::string result;
+
+        if (parameters.reflectedInput)
+        {
+            result = parameters.reflectedOutput ? CrcGenerateFormat("(%s)(crc ^ %s)", type.c_str(), Hex(CrcReflectValue(parameters.xorValue, width)).c_str())
+                                                : CrcGenerateFormat("(%s)(%sReflect(crc) ^ %s)", type.c_str(), name, Hex(parameters.xorValue).c_str());
+        }
+        else
+        {
+            std::string value = (0 == shift) ? std::string("crc") : CrcGenerateFormat("(crc >> %u)", shift);
+            result = parameters.reflectedOutput ? CrcGenerateFormat("%sReflect((%s)(%s ^ %s))", name, type.c_str(), value.c_str(), Hex(parameters.xorValue).c_str())
+                                                : CrcGenerateFormat("(%s)(%s ^ %s)", type.c_str(), value.c_str(), Hex(parameters.xorValue).c_str());
+        }
+        fprintf(file, "    return %s;\n", result.c_str());
+    }
+
+    // Register byte i in the order the data bytes meet it
+    std::string RegisterByte(uint32_t i) const
+    {
+        uint32_t bits = parameters.reflectedInput ? 8 * i : typeWidth - 8 - 8 * i;
+        return (0 == bits) ? std::string("crc") : CrcGenerateFormat("(crc >> %u)", bits);
+    }
+
+    // One data byte with the byte table, reflected register shifts right and normal register left
+    std::string ByteStep(const char *table) const
+    {
+        std::string index = CrcGenerateFormat("(uint8_t)(%s ^ crc_DataPtr[0])", RegisterByte(0).c_str());
+
+        if (8 == typeWidth)
+        {
+            return CrcGenerateFormat("crc = %s[%s];", table, index.c_str());
+        }
+        return CrcGenerateFormat("crc = (%s)((crc %s 8) ^ %s[%s]);", type.c_str(), parameters.reflectedInput ? ">>" : "<<", table, index.c_str());
+    }
+
+    void Kernel(FILE *file) const
+    {
+        std::string table = TableName();
+
+        if (CRC_GENERATE_SLICING == options.kernel)
+        {
+            uint32_t nSlices = options.nSlices;
+
+            fprintf(file, "    while (crc_Length >= %uU)\n    {\n", nSlices);
+            fprintf(file, "        crc = (%s)(", type.c_str());
+            if (8 * nSlices < typeWidth)
+            {
+                fprintf(file, "(crc %s %u) ^\n%*s", parameters.reflectedInput ? ">>" : "<<", 8 * nSlices, 17 + (int)type.size(), "");
+            }
+            for (uint32_t i = 0; i < nSlices; i++)
+            {
+                std::string index = (8 * i < typeWidth) ? CrcGenerateFormat("(uint8_t)(%s ^ crc_DataPtr[%u])", RegisterByte(i).c_str(), i)
+                                                        : CrcGenerateFormat("crc_DataPtr[%u]", i);
+                fprintf(file, "%s[%u][%s]%s", table.c_str(), nSlices - 1 - i, index.c_str(), (i + 1 < nSlices) ? " ^\n" : ");\n");
+                if (i + 1 < nSlices)
+                {
+                    fprintf(file, "%*s", 17 + (int)type.size(), "");
+                }
+            }
+            fprintf(file, "        crc_DataPtr += %uU;\n        crc_Length -= %uU;\n    }\n", nSlices, nSlices);
+            table += "[0]";
+        }
+
+        fprintf(file, "    while (crc_Length > 0U)\n    {\n");
+        if (CRC_GENERATE_BITWISE == options.kernel)
+        {
+            T polynomial = parameters.reflectedInput ? (T)CrcReflectValue(parameters.polynomial, width) : CrcShiftLeft((T)parameters.polynomial, shift);
+
+            if (parameters.reflectedInput || (8 == typeWidth))
+            {
+                fprintf(file, "        crc ^= crc_DataPtr[0];\n");
+            }
+            else
+            {
+                fprintf(file, "        crc ^= (%s)((%s)crc_DataPtr[0] << %u);\n", type.c_str(), type.c_str(), typeWidth - 8);
+            }
+            for (uint32_t bit = 0; bit < 8; bit++)
+            {
+                if (parameters.reflectedInput)
+                {
+                    fprintf(file, "        crc = (%s)((crc >> 1) ^ (%s & (0U - (crc & 1U))));\n", type.c_str(), Hex(polynomial).c_str());
+                }
+                else
+                {
+                    fprintf(file, "        crc = (%s)((crc << 1) ^ (%s & (0U - (crc >> %u))));\n", type.c_str(), Hex(polynomial).c_str(), typeWidth - 1);
+                }
+            }
+        }
+        else if (CRC_GENERATE_NIBBLE == options.kernel)
+        {
+            if (parameters.reflectedInput)
+            {
+                fprintf(file, "        crc = (%s)((crc >> 4) ^ %s[(crc ^ crc_DataPtr[0]) & 0x0FU]);\n", type.c_str(), table.c_str());
+                fprintf(file, "        crc = (%s)((crc >> 4) ^ %s[(crc ^ (crc_DataPtr[0] >> 4)) & 0x0FU]);\n", type.c_str(), table.c_str());
+            }
+            else
+            {
+                fprintf(file, "        crc = (%s)((crc << 4) ^ %s[(uint8_t)((crc >> %u) ^ (crc_DataPtr[0] >> 4))]);\n", type.c_str(), table.c_str(), typeWidth - 4);
+                fprintf(file, "        crc = (%s)((crc << 4) ^ %s[(uint8_t)((crc >> %u) ^ (crc_DataPtr[0] & 0x0FU))]);\n", type.c_str(), table.c_str(), typeWidth - 4);
+            }
+        }
+        else
+        {
+            fprintf(file, "        %s\n", ByteStep(table.c_str()).c_str());
+        }
+        fprintf(file, "        crc_DataPtr++;\n        crc_Length--;\n    }\n");
+    }
+
+    const CrcGenerateOptions &options;
+    const CrcModelParameters &parameters;
+    uint32_t width;
+    uint32_t typeWidth;
+    uint32_t shift;
+    std::string type;
+    const char *name;
+    std::vector<std::vector<T>> tables;
+};
+
+template <class T>
+static bool CrcGenerate(const CrcGenerateOptions &options, const char *sourcePath, const char *testPath)
+{
+    CrcGenerator<T> generator(options);
+
+    if ((0 != options.parameters.check) && (generator.Check() != (T)options.parameters.check))
+    {
+        fprintf(stderr, "Check value of %s differs from the catalogue\n", options.parameters.name);
+        return false;
+    }
+
+    FILE *file = fopen(sourcePath, "w");
+    if (nullptr == file)
+    {
+        fprintf(stderr, "Cannot write %s\n", sourcePath);
+        return false;
+    }
+    generator.Source(file);
+    fclose(file);
+
+    if (nullptr != testPath)
+    {
+        file = fopen(testPath, "w");
+        if (nullptr == file)
+        {
+            fprintf(stderr, "Cannot write %s\n", testPath);
+            return false;
+        }
+        generator.Test(file);
+        fclose(file);
+    }
+    return true;
+}
+
+// "bitwise", "nibble", "byte" or "slicingN"
+static bool CrcGenerateParseKernel(const char *argument, CrcGenerateOptions &options)
+{
+    if (0 == strcmp(argument, "bitwise"))
+    {
+        options.kernel = CRC_GENERATE_BITWISE;
+    }
+    else if (0 == strcmp(argument, "nibble"))
+    {
+        options.kernel = CRC_GENERATE_NIBBLE;
+    }
+    else if (0 == strcmp(argument, "byte"))
+    {
+        options.kernel = CRC_GENERATE_BYTE;
+    }
+    else if (0 == strncmp(argument, "slicing", 7))
+    {
+        char *end;
+        unsigned long nSlices = strtoul(argument + 7, &end, 10);
+        if ((end == argument + 7) || ('\0' != *end) || (nSlices < 2) || (nSlices > CRC_GENERATE_MAX_SLICES))
+        {
+            return false;
+        }
+        options.kernel = CRC_GENERATE_SLICING;
+        options.nSlices = (uint8_t)nSlices;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    CrcGenerateOptions options = {};
+    const char *sourcePath = nullptr;
+    const char *testPath = nullptr;
+    bool valid = true;
+
+    options.kernel = CRC_GENERATE_BYTE;
+    options.nSlices = 1;
+
+    for (int i = 1; (i < argc) && valid; i++)
+    {
+        if ((0 == strcmp(argv[i], "--model")) && (i + 1 < argc))
+        {
+            const CrcRegisteredModel *model = CrcFindModel(argv[++i]);
+            if (nullptr == model)
+            {
+                fprintf(stderr, "Unknown model %s\n", argv[i]);
+                return 2;
+            }
+            options.parameters = model->parameters;
+        }
+        else if ((0 == strcmp(argv[i], "--width")) && (i + 1 < argc))
+        {
+            options.parameters.width = (uint8_t)atoi(argv[++i]);
+        }
+        else if ((0 == strcmp(argv[i], "--poly")) && (i + 1 < argc))
+        {
+            options.parameters.polynomial = strtoull(argv[++i], nullptr, 16);
+        }
+        else if ((0 == strcmp(argv[i], "--init")) && (i + 1 < argc))
+        {
+            options.parameters.initialValue = strtoull(argv[++i], nullptr, 16);
+        }
+        else if ((0 == strcmp(argv[i], "--xor")) && (i + 1 < argc))
+        {
+            options.parameters.xorValue = strtoull(argv[++i], nullptr, 16);
+        }
+        else if (0 == strcmp(argv[i], "--refin"))
+        {
+            options.parameters.reflectedInput = true;
+        }
+        else if (0 == strcmp(argv[i], "--refout"))
+        {
+            options.parameters.reflectedOutput = true;
+        }
+        else if ((0 == strcmp(argv[i], "--kernel")) && (i + 1 < argc))
+        {
+            valid = CrcGenerateParseKernel(argv[++i], options);
+        }
+        else if ((0 == strcmp(argv[i], "--name")) && (i + 1 < argc))
+        {
+            options.name = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "--output")) && (i + 1 < argc))
+        {
+            sourcePath = argv[++i];
+        }
+        else if ((0 == strcmp(argv[i], "--test")) && (i + 1 < argc))
+        {
+            testPath = argv[++i];
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+
+    uint8_t width = options.parameters.width;
+    if (!valid || (nullptr == sourcePath) || (width < 3) || (width > 64))
+    {
+        fprintf(stderr, "Usage: %s (--model NAME | --width W --poly P [--init I] [--xor X] [--refin] [--refout])\n"
+                        "       [--kernel bitwise|nibble|byte|slicingN] [--name FUNCTION] --output FILE [--test FILE]\n", argv[0]);
+        return 2;
+    }
+
+    // Values above the width are dropped like CalculateCRC() does with left alignment
+    uint64_t mask = ~0ULL >> (64 - width);
+    options.parameters.polynomial &= mask;
+    options.parameters.initialValue &= mask;
+    options.parameters.xorValue &= mask;
+    if (options.name.empty())
+    {
+        options.name = (nullptr != options.parameters.name) ? CrcGenerateFunctionName(options.parameters.name) : CrcGenerateFormat("Crc%u", width);
+    }
+
+    bool generated;
+    if (width <= 8)
+    {
+        generated = CrcGenerate<uint8_t>(options, sourcePath, testPath);
+    }
+    else if (width <= 16)
+    {
+        generated = CrcGenerate<uint16_t>(options, sourcePath, testPath);
+    }
+    else if (width <= 32)
+    {
+        generated = CrcGenerate<uint32_t>(options, sourcePath, testPath);
+    }
+    else
+    {
+        generated = CrcGenerate<uint64_t>(options, sourcePath, testPath);
+    }
+
+    return generated ? 0 : 1;
+}
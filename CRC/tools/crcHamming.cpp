@@ -0,0 +1,101 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../crcHamming.h"
+
+//Hamming distance and undetected errors of a CRC polynomial per data length, see crcHamming.h.
+//
+//Build:
+//    g++ -std=c++17 -O2 -pthread CRC/tools/crcHamming.cpp CRC/crcHamming.cpp CRC/crcThreadPool.cpp -o crcHamming
+//Usage:
+//    crcHamming <width> <polynomial> <dataBits | first-last>...
+//
+//Polynomial is hex in normal form without the top bit, e.g. crcHamming 8 2F 64 1-256. A single length prints the
+//number of undetected errors of weight HD, a range prints the lengths where the Hamming distance changes.
+
+// "first-last" or a single length
+static bool CrcHammingParse(const char *argument, uint32_t &first, uint32_t &last)
+{
+    char *end;
+
+    first = (uint32_t)strtoul(argument, &end, 10);
+    last = first;
+    if ('-' == *end)
+    {
+        last = (uint32_t)strtoul(end + 1, &end, 10);
+    }
+    return (end != argument) && ('\0' == *end) && (first >= 1) && (first <= last);
+}
+
+static void CrcHammingPrintDistance(uint8_t hammingDistance)
+{
+    printf((hammingDistance > CRC_HAMMING_MAX_WEIGHT) ? "HD>=%u" : "HD=%u", hammingDistance);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 4)
+    {
+        fprintf(stderr, "Usage: %s <width> <polynomial> <dataBits | first-last>...\n", argv[0]);
+        return 2;
+    }
+
+    uint8_t width = (uint8_t)atoi(argv[1]);
+    uint64_t polynomial = strtoull(argv[2], nullptr, 16);
+    std::vector<uint32_t> dataBits;
+    std::vector<uint32_t> rangeEnds;    // index after the last length of each argument
+
+    for (int i = 3; i < argc; i++)
+    {
+        uint32_t first;
+        uint32_t last;
+        if (!CrcHammingParse(argv[i], first, last))
+        {
+            fprintf(stderr, "Invalid length %s\n", argv[i]);
+            return 2;
+        }
+        for (uint32_t length = first; length <= last; length++)
+        {
+            dataBits.push_back(length);
+        }
+        rangeEnds.push_back((uint32_t)dataBits.size());
+    }
+
+    std::vector<CrcHammingResult> results(dataBits.size());
+    if (!CrcHammingEvaluate(width, polynomial, dataBits.data(), (uint32_t)dataBits.size(), results.data()))
+    {
+        fprintf(stderr, "Invalid width or polynomial\n");
+        return 2;
+    }
+
+    uint32_t begin = 0;
+    for (uint32_t end : rangeEnds)
+    {
+        if (1 == end - begin)
+        {
+            printf("%u data bits: ", results[begin].dataBits);
+            CrcHammingPrintDistance(results[begin].hammingDistance);
+            printf(", %llu undetected errors of weight %u\n", (unsigned long long)results[begin].undetected, results[begin].hammingDistance);
+        }
+        else
+        {
+            for (uint32_t i = begin; i < end; )
+            {
+                uint32_t j = i;
+                while ((j + 1 < end) && (results[j + 1].hammingDistance == results[i].hammingDistance))
+                {
+                    j++;
+                }
+                CrcHammingPrintDistance(results[i].hammingDistance);
+                printf(" for %u..%u data bits\n", results[i].dataBits, results[j].dataBits);
+                i = j + 1;
+            }
+        }
+        begin = end;
+    }
+
+    return 0;
+}
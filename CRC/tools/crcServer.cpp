@@ -0,0 +1,48 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <signal.h>
+
+#include "../crcService.h"
+
+//CRC service daemon for the processes of this host, see crcService.h.
+//
+//Build:
+//    g++ -std=c++17 -O2 -pthread CRC/tools/crcServer.cpp CRC/crcService.cpp CRC/crcRegistry.cpp CRC/crcBatch.cpp
+//        CRC/crc8.cpp CRC/crc16.cpp CRC/crc32.cpp CRC/crc64.cpp CRC/crcClmul.cpp CRC/reflect.cpp -o crcServer
+//Clients link CRC/crcServiceClient.cpp.
+//Usage:
+//    crcServer [socket path]
+//
+//Default socket is /tmp/crcService.sock, an existing file at the path which is not a socket is never removed.
+//SIGINT or SIGTERM stop the server and remove the socket.
+
+static CrcServiceServer crcServer;
+
+static void CrcServerSignal(int signalNumber)
+{
+    (void)signalNumber;
+    crcServer.Stop();
+}
+
+int main(int argc, char *argv[])
+{
+    const char *path = (argc > 1) ? argv[1] : CRC_SERVICE_DEFAULT_PATH;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: %s [socket path]\n", argv[0]);
+        return 2;
+    }
+    if (!crcServer.Open(path))
+    {
+        fprintf(stderr, "Cannot listen on %s\n", path);
+        return 1;
+    }
+
+    signal(SIGINT, CrcServerSignal);
+    signal(SIGTERM, CrcServerSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    crcServer.Run();
+    return 0;
+}
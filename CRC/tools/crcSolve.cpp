@@ -0,0 +1,130 @@
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "../crcSolver.h"
+
+//CRC parameters from captured messages and their CRCs, see crcSolver.h.
+//
+//Build:
+//    g++ -std=c++17 -O2 -pthread CRC/tools/crcSolve.cpp CRC/crcSolver.cpp CRC/crcRegistry.cpp CRC/crcThreadPool.cpp
+//        CRC/crc8.cpp CRC/crc16.cpp CRC/crc32.cpp CRC/crc64.cpp CRC/crcClmul.cpp CRC/reflect.cpp -o crcSolve
+//Usage:
+//    crcSolve [--exhaustive] <width> <message:crc>...
+//
+//Message and CRC are hex strings, e.g. crcSolve 16 313233343536373839:4B37 0102:...
+//Searches of more than CRC_SOLVER_SEARCH_LIMIT polynomials take minutes and are refused without --exhaustive, more
+//messages of the same length make the search smaller.
+
+#define CRC_SOLVE_MAX_RESULTS   16U
+
+static int CrcSolveHexDigit(char digit)
+{
+    if ((digit >= '0') && (digit <= '9'))
+    {
+        return digit - '0';
+    }
+    if ((digit >= 'a') && (digit <= 'f'))
+    {
+        return digit - 'a' + 10;
+    }
+    if ((digit >= 'A') && (digit <= 'F'))
+    {
+        return digit - 'A' + 10;
+    }
+    return -1;
+}
+
+// "message:crc" into bytes and CRC value
+static bool CrcSolveParse(const char *argument, std::vector<uint8_t> &message, uint64_t &crc)
+{
+    const char *separator = strchr(argument, ':');
+    if ((nullptr == separator) || (0 != (separator - argument) % 2))
+    {
+        return false;
+    }
+
+    for (const char *digit = argument; digit < separator; digit += 2)
+    {
+        int high = CrcSolveHexDigit(digit[0]);
+        int low = CrcSolveHexDigit(digit[1]);
+        if ((high < 0) || (low < 0))
+        {
+            return false;
+        }
+        message.push_back((uint8_t)(high * 16 + low));
+    }
+
+    char *end;
+    crc = strtoull(separator + 1, &end, 16);
+    return ('\0' != separator[1]) && ('\0' == *end);
+}
+
+int main(int argc, char *argv[])
+{
+    bool exhaustive = (argc > 1) && (0 == strcmp(argv[1], "--exhaustive"));
+    int first = exhaustive ? 2 : 1;
+
+    if (argc < first + 2)
+    {
+        fprintf(stderr, "Usage: %s [--exhaustive] <width> <message:crc>...\n", argv[0]);
+        return 2;
+    }
+
+    int width = atoi(argv[first]);
+    if ((width < 3) || (width > 64))
+    {
+        fprintf(stderr, "Width must be 3..64\n");
+        return 2;
+    }
+
+    uint32_t nSamples = (uint32_t)(argc - first - 1);
+    std::vector<std::vector<uint8_t>> messages(nSamples);
+    std::vector<CrcSolverSample> samples(nSamples);
+
+    for (uint32_t i = 0; i < nSamples; i++)
+    {
+        if (!CrcSolveParse(argv[first + 1 + i], messages[i], samples[i].crc))
+        {
+            fprintf(stderr, "Invalid sample %s\n", argv[first + 1 + i]);
+            return 2;
+        }
+        samples[i].crc_DataPtr = messages[i].data();
+        samples[i].crc_Length = (uint32_t)messages[i].size();
+    }
+
+    uint64_t nCandidates = CrcSolveCandidates((uint8_t)width, samples.data(), nSamples);
+    if (!exhaustive && (nCandidates > CRC_SOLVER_SEARCH_LIMIT))
+    {
+        fprintf(stderr, "%" PRIu64 " polynomials to search, give more messages of the same length or --exhaustive\n", nCandidates);
+        return 1;
+    }
+
+    CrcSolverResult results[CRC_SOLVE_MAX_RESULTS];
+    uint32_t nResults = CrcSolve((uint8_t)width, samples.data(), nSamples, results, CRC_SOLVE_MAX_RESULTS,
+                                 exhaustive ? UINT64_MAX : CRC_SOLVER_SEARCH_LIMIT);
+    int nDigits = (width + 3) / 4;
+
+    for (uint32_t i = 0; i < nResults; i++)
+    {
+        const CrcModelParameters &parameters = results[i].parameters;
+
+        printf("width=%u poly=0x%0*llx init=0x%0*llx refin=%s refout=%s xorout=0x%0*llx check=0x%0*llx%s%s%s\n", parameters.width,
+               nDigits, (unsigned long long)parameters.polynomial, nDigits, (unsigned long long)parameters.initialValue,
+               parameters.reflectedInput ? "true" : "false", parameters.reflectedOutput ? "true" : "false",
+               nDigits, (unsigned long long)parameters.xorValue, nDigits, (unsigned long long)parameters.check,
+               (nullptr != parameters.name) ? " name=" : "", (nullptr != parameters.name) ? parameters.name : "",
+               results[i].uniqueInitialValue ? "" : " (init not unique)");
+    }
+
+    if (0 == nResults)
+    {
+        fprintf(stderr, "No parameters found\n");
+        return 1;
+    }
+
+    return 0;
+}
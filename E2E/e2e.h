@@ -0,0 +1,204 @@
+#ifndef E2E_H
+#define E2E_H
+
+#include <stdint.h>
+
+//This source code is helper for implementing E2E protection by AutoSar documentation: E2E Protocol Specification.
+// https://www.autosar.org/fileadmin/files/standards/foundation/
+//
+//Protect writes counter, Data ID dependent CRC and (Profile 4) length and Data ID into a PDU, Check verifies them
+//on the receiver. Offsets and lengths in the configurations are in bits, as in the specification.
+//
+//Profile 1 - CRC8 SAE-J1850, 4 bit counter, Data ID 16 bit (not transmitted)
+//Profile 2 - CRC8H2F, 4 bit counter, Data ID 8 bit from a list indexed by the counter (not transmitted)
+//Profile 4 - CRC32P4, 16 bit counter, 32 bit Data ID and 16 bit length in a 12 byte header
+//Profile 5 - CRC16 CCITT-FALSE, 8 bit counter, Data ID 16 bit (not transmitted)
+//
+//Batch functions protect or check nMessages PDUs of the same data element, the result is the same as calling
+//Protect or Check for each PDU in order. Profile 1 puts the Data ID before the PDU bytes, its CRC register is
+//calculated once per batch, so per PDU only the PDU bytes are calculated.
+
+typedef uint8_t Std_ReturnType;
+
+#define E_OK                    0x00U
+#define E2E_E_INPUTERR_NULL     0x13U
+#define E2E_E_INPUTERR_WRONG    0x17U
+#define E2E_E_INTERR            0x19U
+#define E2E_E_WRONGSTATE        0x1AU
+
+/* Profile 1 */
+
+typedef enum
+{
+    E2E_P01_DATAID_BOTH = 0x00,     // both bytes of Data ID in the CRC
+    E2E_P01_DATAID_ALT = 0x01,      // low byte for even counter, high byte for odd counter
+    E2E_P01_DATAID_LOW = 0x02,      // low byte only, high byte has to be 0
+    E2E_P01_DATAID_NIBBLE = 0x03    // low byte in the CRC, low nibble of high byte transmitted in the PDU
+} E2E_P01DataIDMode;
+
+typedef struct
+{
+    uint16_t CounterOffset;
+    uint16_t CRCOffset;
+    uint16_t DataID;
+    uint16_t DataIDNibbleOffset;
+    E2E_P01DataIDMode DataIDMode;
+    uint16_t DataLength;
+    uint8_t MaxDeltaCounterInit;
+    uint8_t MaxNoNewOrRepeatedData;
+    uint8_t SyncCounterInit;
+} E2E_P01ConfigType;
+
+typedef struct
+{
+    uint8_t Counter;
+} E2E_P01ProtectStateType;
+
+typedef enum
+{
+    E2E_P01STATUS_OK = 0x00,
+    E2E_P01STATUS_NONEWDATA = 0x01,
+    E2E_P01STATUS_WRONGCRC = 0x02,
+    E2E_P01STATUS_SYNC = 0x03,
+    E2E_P01STATUS_INITIAL = 0x04,
+    E2E_P01STATUS_REPEATED = 0x08,
+    E2E_P01STATUS_OKSOMELOST = 0x20,
+    E2E_P01STATUS_WRONGSEQUENCE = 0x40
+} E2E_P01CheckStatusType;
+
+typedef struct
+{
+    uint8_t LastValidCounter;
+    uint8_t MaxDeltaCounter;
+    bool WaitForFirstData;
+    bool NewDataAvailable;
+    uint8_t LostData;
+    E2E_P01CheckStatusType Status;
+    uint8_t SyncCounter;
+    uint8_t NoNewOrRepeatedDataCounter;
+} E2E_P01CheckStateType;
+
+Std_ReturnType E2E_P01Protect(const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, uint8_t *DataPtr);
+Std_ReturnType E2E_P01Check(const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const uint8_t *DataPtr);
+Std_ReturnType E2E_P01ProtectBatch(const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, uint8_t *const DataPtrs[], uint32_t nMessages);
+Std_ReturnType E2E_P01CheckBatch(const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const uint8_t *const DataPtrs[], uint32_t nMessages, E2E_P01CheckStatusType Statuses[]);
+
+/* Profile 2 */
+
+typedef struct
+{
+    uint16_t DataLength;
+    uint8_t DataIDList[16];
+    uint8_t MaxDeltaCounterInit;
+    uint8_t MaxNoNewOrRepeatedData;
+    uint8_t SyncCounterInit;
+} E2E_P02ConfigType;
+
+typedef struct
+{
+    uint8_t Counter;
+} E2E_P02ProtectStateType;
+
+typedef enum
+{
+    E2E_P02STATUS_OK = 0x00,
+    E2E_P02STATUS_NONEWDATA = 0x01,
+    E2E_P02STATUS_WRONGCRC = 0x02,
+    E2E_P02STATUS_SYNC = 0x03,
+    E2E_P02STATUS_INITIAL = 0x04,
+    E2E_P02STATUS_REPEATED = 0x08,
+    E2E_P02STATUS_OKSOMELOST = 0x20,
+    E2E_P02STATUS_WRONGSEQUENCE = 0x40
+} E2E_P02CheckStatusType;
+
+typedef struct
+{
+    uint8_t LastValidCounter;
+    uint8_t MaxDeltaCounter;
+    bool WaitForFirstData;
+    bool NewDataAvailable;
+    uint8_t LostData;
+    E2E_P02CheckStatusType Status;
+    uint8_t SyncCounter;
+    uint8_t NoNewOrRepeatedDataCounter;
+} E2E_P02CheckStateType;
+
+Std_ReturnType E2E_P02Protect(const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8_t *DataPtr);
+Std_ReturnType E2E_P02Check(const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8_t *DataPtr);
+Std_ReturnType E2E_P02ProtectBatch(const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8_t *const DataPtrs[], uint32_t nMessages);
+Std_ReturnType E2E_P02CheckBatch(const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8_t *const DataPtrs[], uint32_t nMessages, E2E_P02CheckStatusType Statuses[]);
+
+/* Profile 4 */
+
+typedef struct
+{
+    uint32_t DataID;
+    uint16_t Offset;
+    uint16_t MinDataLength;
+    uint16_t MaxDataLength;
+    uint16_t MaxDeltaCounter;
+} E2E_P04ConfigType;
+
+typedef struct
+{
+    uint16_t Counter;
+} E2E_P04ProtectStateType;
+
+typedef enum
+{
+    E2E_P04STATUS_OK = 0x00,
+    E2E_P04STATUS_NONEWDATA = 0x01,
+    E2E_P04STATUS_ERROR = 0x07,
+    E2E_P04STATUS_REPEATED = 0x08,
+    E2E_P04STATUS_OKSOMELOST = 0x20,
+    E2E_P04STATUS_WRONGSEQUENCE = 0x40
+} E2E_P04CheckStatusType;
+
+typedef struct
+{
+    E2E_P04CheckStatusType Status;
+    uint16_t Counter;
+} E2E_P04CheckStateType;
+
+Std_ReturnType E2E_P04Protect(const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8_t *DataPtr, uint16_t Length);
+Std_ReturnType E2E_P04Check(const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8_t *DataPtr, uint16_t Length);
+Std_ReturnType E2E_P04ProtectBatch(const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8_t *const DataPtrs[], const uint16_t Lengths[], uint32_t nMessages);
+Std_ReturnType E2E_P04CheckBatch(const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8_t *const DataPtrs[], const uint16_t Lengths[], uint32_t nMessages, E2E_P04CheckStatusType Statuses[]);
+
+/* Profile 5 */
+
+typedef struct
+{
+    uint16_t Offset;
+    uint16_t DataLength;
+    uint16_t DataID;
+    uint8_t MaxDeltaCounter;
+} E2E_P05ConfigType;
+
+typedef struct
+{
+    uint8_t Counter;
+} E2E_P05ProtectStateType;
+
+typedef enum
+{
+    E2E_P05STATUS_OK = 0x00,
+    E2E_P05STATUS_NONEWDATA = 0x01,
+    E2E_P05STATUS_ERROR = 0x07,
+    E2E_P05STATUS_REPEATED = 0x08,
+    E2E_P05STATUS_OKSOMELOST = 0x20,
+    E2E_P05STATUS_WRONGSEQUENCE = 0x40
+} E2E_P05CheckStatusType;
+
+typedef struct
+{
+    E2E_P05CheckStatusType Status;
+    uint8_t Counter;
+} E2E_P05CheckStateType;
+
+Std_ReturnType E2E_P05Protect(const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8_t *DataPtr, uint16_t Length);
+Std_ReturnType E2E_P05Check(const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8_t *DataPtr, uint16_t Length);
+Std_ReturnType E2E_P05ProtectBatch(const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8_t *const DataPtrs[], uint32_t nMessages);
+Std_ReturnType E2E_P05CheckBatch(const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8_t *const DataPtrs[], uint32_t nMessages, E2E_P05CheckStatusType Statuses[]);
+
+#endif /* E2E_H */
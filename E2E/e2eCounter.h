@@ -0,0 +1,119 @@
+#ifndef E2E_COUNTER_H
+#define E2E_COUNTER_H
+
+#include <stdint.h>
+
+//Counter evaluation of the Check functions, shared by the profiles. Profiles 1 and 2 have the same state machine
+//with a different counter range, profiles 4 and 5 have the same one with a different counter width.
+
+// Profile 1 (CounterRange 15) and Profile 2 (CounterRange 16). Called after the CRC of the PDU is valid.
+// Status is the E2E_P01CheckStatusType or E2E_P02CheckStatusType value, both have the same numbering.
+template <class StateType, class ConfigType, uint8_t CounterRange>
+void E2E_P0102CheckCounter(const ConfigType *ConfigPtr, StateType *StatePtr, uint8_t receivedCounter)
+{
+    typedef decltype(StatePtr->Status) StatusType;
+
+    if (StatePtr->WaitForFirstData)
+    {
+        StatePtr->WaitForFirstData = false;
+        StatePtr->MaxDeltaCounter = ConfigPtr->MaxDeltaCounterInit;
+        StatePtr->LastValidCounter = receivedCounter;
+        StatePtr->Status = (StatusType)0x04;    // INITIAL
+        return;
+    }
+
+    uint8_t deltaCounter = (uint8_t)((receivedCounter + CounterRange - StatePtr->LastValidCounter) % CounterRange);
+
+    if (0 == deltaCounter)
+    {
+        if (StatePtr->NoNewOrRepeatedDataCounter < (CounterRange - 1))
+        {
+            StatePtr->NoNewOrRepeatedDataCounter++;
+        }
+        StatePtr->Status = (StatusType)0x08;    // REPEATED
+    }
+    else if (deltaCounter <= StatePtr->MaxDeltaCounter)
+    {
+        StatePtr->MaxDeltaCounter = ConfigPtr->MaxDeltaCounterInit;
+        StatePtr->LastValidCounter = receivedCounter;
+        StatePtr->LostData = deltaCounter - 1;
+
+        // too many PDUs without new data, receiver has to see SyncCounterInit valid PDUs before OK again
+        if (StatePtr->NoNewOrRepeatedDataCounter > ConfigPtr->MaxNoNewOrRepeatedData)
+        {
+            StatePtr->SyncCounter = ConfigPtr->SyncCounterInit;
+        }
+        StatePtr->NoNewOrRepeatedDataCounter = 0;
+
+        if (StatePtr->SyncCounter > 0)
+        {
+            StatePtr->SyncCounter--;
+            StatePtr->Status = (StatusType)0x03;    // SYNC
+        }
+        else
+        {
+            StatePtr->Status = (StatusType)((1 == deltaCounter) ? 0x00 : 0x20);    // OK or OKSOMELOST
+        }
+    }
+    else
+    {
+        StatePtr->NoNewOrRepeatedDataCounter = 0;
+        StatePtr->SyncCounter = ConfigPtr->SyncCounterInit;
+        if (StatePtr->SyncCounter > 0)
+        {
+            StatePtr->MaxDeltaCounter = ConfigPtr->MaxDeltaCounterInit;
+            StatePtr->LastValidCounter = receivedCounter;
+        }
+        StatePtr->Status = (StatusType)0x40;    // WRONGSEQUENCE
+    }
+}
+
+// Profile 1 and 2, start of every Check call. Returns false if there is no new data to check.
+template <class StateType, uint8_t CounterRange>
+bool E2E_P0102CheckNewData(StateType *StatePtr)
+{
+    typedef decltype(StatePtr->Status) StatusType;
+
+    if (StatePtr->MaxDeltaCounter < (CounterRange - 1))
+    {
+        StatePtr->MaxDeltaCounter++;
+    }
+
+    if (!StatePtr->NewDataAvailable)
+    {
+        if (StatePtr->NoNewOrRepeatedDataCounter < (CounterRange - 1))
+        {
+            StatePtr->NoNewOrRepeatedDataCounter++;
+        }
+        StatePtr->Status = (StatusType)0x01;    // NONEWDATA
+        return false;
+    }
+
+    return true;
+}
+
+// Profile 4 (uint16_t counter) and Profile 5 (uint8_t counter). Called after length, Data ID and CRC are valid.
+template <class StateType, class CounterType>
+void E2E_P0405CheckCounter(CounterType maxDeltaCounter, StateType *StatePtr, CounterType receivedCounter)
+{
+    typedef decltype(StatePtr->Status) StatusType;
+
+    CounterType deltaCounter = (CounterType)(receivedCounter - StatePtr->Counter);
+
+    if (deltaCounter > maxDeltaCounter)
+    {
+        StatePtr->Status = (StatusType)0x40;    // WRONGSEQUENCE
+    }
+    else if (0 == deltaCounter)
+    {
+        StatePtr->Status = (StatusType)0x08;    // REPEATED
+    }
+    else
+    {
+        StatePtr->Status = (StatusType)((1 == deltaCounter) ? 0x00 : 0x20);    // OK or OKSOMELOST
+    }
+
+    StatePtr->Counter = receivedCounter;
+}
+
+#endif /* E2E_COUNTER_H */
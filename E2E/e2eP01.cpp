@@ -0,0 +1,203 @@
+#include <stdint.h>
+
+#include "e2e.h"
+#include "e2eCounter.h"
+#include "../CRC/crcModel.h"
+
+//This source code is helper for implementing E2E protection by AutoSar documentation: E2E Protocol Specification.
+// https://www.autosar.org/fileadmin/files/standards/foundation/
+
+//Profile 1: CRC8 SAE-J1850 over Data ID and all PDU bytes except the CRC byte, 4 bit counter 0..14.
+//
+//The specification calculates the CRC with Crc_CalculateCRC8(..., 0xFF, FALSE) for every part and xors the
+//result with 0xFF, so the CRC is the bare register: start 0x00, no final xor. The register after the Data ID
+//depends only on the configuration (and the counter parity for E2E_P01_DATAID_ALT), batch functions calculate
+//it once.
+
+#define E2E_P01_COUNTER_RANGE   15U
+
+// Register after the Data ID bytes for even [0] and odd [1] counter values
+struct E2E_P01DataIDCrc
+{
+    uint8_t crc[2];
+};
+
+static E2E_P01DataIDCrc E2E_P01CalculateDataIDCrc(const E2E_P01ConfigType *ConfigPtr)
+{
+    uint8_t dataID[2] = { (uint8_t)ConfigPtr->DataID, (uint8_t)(ConfigPtr->DataID >> 8) };
+    uint8_t zero = 0x00;
+    uint8_t crc = Crc8SaeJ1850::Restart(0xFF);
+    E2E_P01DataIDCrc dataIDCrc;
+
+    switch (ConfigPtr->DataIDMode)
+    {
+    case E2E_P01_DATAID_ALT:
+        dataIDCrc.crc[0] = Crc8SaeJ1850::Update(crc, &dataID[0], 1);
+        dataIDCrc.crc[1] = Crc8SaeJ1850::Update(crc, &dataID[1], 1);
+        return dataIDCrc;
+    case E2E_P01_DATAID_LOW:
+        crc = Crc8SaeJ1850::Update(crc, &dataID[0], 1);
+        break;
+    case E2E_P01_DATAID_NIBBLE:
+        // high byte is transmitted as nibble in the PDU, 0 is used instead of it
+        crc = Crc8SaeJ1850::Update(crc, &dataID[0], 1);
+        crc = Crc8SaeJ1850::Update(crc, &zero, 1);
+        break;
+    default:
+        crc = Crc8SaeJ1850::Update(crc, dataID, 2);
+        break;
+    }
+
+    dataIDCrc.crc[0] = crc;
+    dataIDCrc.crc[1] = crc;
+    return dataIDCrc;
+}
+
+// CRC of the PDU bytes before and after the CRC byte, continued from the Data ID register
+static uint8_t E2E_P01CalculateCrc(const E2E_P01ConfigType *ConfigPtr, const E2E_P01DataIDCrc &dataIDCrc, uint8_t counter, const uint8_t *DataPtr)
+{
+    uint32_t crcByte = ConfigPtr->CRCOffset / 8;
+    uint32_t length = ConfigPtr->DataLength / 8;
+    uint8_t crc = dataIDCrc.crc[counter & 1U];
+
+    crc = Crc8SaeJ1850::Update(crc, DataPtr, crcByte);
+    crc = Crc8SaeJ1850::Update(crc, &DataPtr[crcByte + 1], length - crcByte - 1);
+
+    return Crc8SaeJ1850::Finalize(crc) ^ 0xFF;
+}
+
+static uint8_t E2E_P01ReadNibble(const uint8_t *DataPtr, uint16_t offset)
+{
+    return (0 == (offset % 8)) ? (DataPtr[offset / 8] & 0x0F) : (DataPtr[offset / 8] >> 4);
+}
+
+static void E2E_P01WriteNibble(uint8_t *DataPtr, uint16_t offset, uint8_t value)
+{
+    if (0 == (offset % 8))
+    {
+        DataPtr[offset / 8] = (DataPtr[offset / 8] & 0xF0) | (value & 0x0F);
+    }
+    else
+    {
+        DataPtr[offset / 8] = (DataPtr[offset / 8] & 0x0F) | (uint8_t)(value << 4);
+    }
+}
+
+static Std_ReturnType E2E_P01ProtectData(const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, const E2E_P01DataIDCrc &dataIDCrc, uint8_t *DataPtr)
+{
+    if (nullptr == DataPtr)
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    E2E_P01WriteNibble(DataPtr, ConfigPtr->CounterOffset, StatePtr->Counter);
+    if (E2E_P01_DATAID_NIBBLE == ConfigPtr->DataIDMode)
+    {
+        E2E_P01WriteNibble(DataPtr, ConfigPtr->DataIDNibbleOffset, (uint8_t)(ConfigPtr->DataID >> 8));
+    }
+
+    DataPtr[ConfigPtr->CRCOffset / 8] = E2E_P01CalculateCrc(ConfigPtr, dataIDCrc, StatePtr->Counter, DataPtr);
+
+    StatePtr->Counter = (StatePtr->Counter + 1) % E2E_P01_COUNTER_RANGE;
+
+    return E_OK;
+}
+
+static Std_ReturnType E2E_P01CheckData(const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const E2E_P01DataIDCrc &dataIDCrc, const uint8_t *DataPtr)
+{
+    if (!E2E_P0102CheckNewData<E2E_P01CheckStateType, E2E_P01_COUNTER_RANGE>(StatePtr))
+    {
+        return E_OK;
+    }
+
+    uint8_t receivedCounter = E2E_P01ReadNibble(DataPtr, ConfigPtr->CounterOffset);
+    if (receivedCounter >= E2E_P01_COUNTER_RANGE)
+    {
+        return E2E_E_INPUTERR_WRONG;
+    }
+
+    bool crcValid = (DataPtr[ConfigPtr->CRCOffset / 8] == E2E_P01CalculateCrc(ConfigPtr, dataIDCrc, receivedCounter, DataPtr));
+    if ((E2E_P01_DATAID_NIBBLE == ConfigPtr->DataIDMode) &&
+        (E2E_P01ReadNibble(DataPtr, ConfigPtr->DataIDNibbleOffset) != ((ConfigPtr->DataID >> 8) & 0x0F)))
+    {
+        crcValid = false;
+    }
+
+    if (!crcValid)
+    {
+        StatePtr->Status = E2E_P01STATUS_WRONGCRC;
+        return E_OK;
+    }
+
+    E2E_P0102CheckCounter<E2E_P01CheckStateType, E2E_P01ConfigType, E2E_P01_COUNTER_RANGE>(ConfigPtr, StatePtr, receivedCounter);
+
+    return E_OK;
+}
+
+Std_ReturnType E2E_P01Protect(const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, uint8_t *DataPtr)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P01ProtectData(ConfigPtr, StatePtr, E2E_P01CalculateDataIDCrc(ConfigPtr), DataPtr);
+}
+
+// StatePtr->NewDataAvailable tells if DataPtr holds a new PDU
+Std_ReturnType E2E_P01Check(const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const uint8_t *DataPtr)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (StatePtr->NewDataAvailable && (nullptr == DataPtr)))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P01CheckData(ConfigPtr, StatePtr, E2E_P01CalculateDataIDCrc(ConfigPtr), DataPtr);
+}
+
+// Next nMessages PDUs of the data element, DataPtrs[i] gets counter value of message i
+Std_ReturnType E2E_P01ProtectBatch(const E2E_P01ConfigType *ConfigPtr, E2E_P01ProtectStateType *StatePtr, uint8_t *const DataPtrs[], uint32_t nMessages)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    E2E_P01DataIDCrc dataIDCrc = E2E_P01CalculateDataIDCrc(ConfigPtr);
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        Std_ReturnType result = E2E_P01ProtectData(ConfigPtr, StatePtr, dataIDCrc, DataPtrs[i]);
+        if (E_OK != result)
+        {
+            return result;
+        }
+    }
+
+    return E_OK;
+}
+
+// Received PDUs in order, nullptr entry is a cycle without new data. Statuses[i] is the status after PDU i.
+Std_ReturnType E2E_P01CheckBatch(const E2E_P01ConfigType *ConfigPtr, E2E_P01CheckStateType *StatePtr, const uint8_t *const DataPtrs[], uint32_t nMessages, E2E_P01CheckStatusType Statuses[])
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs) || (nullptr == Statuses))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    E2E_P01DataIDCrc dataIDCrc = E2E_P01CalculateDataIDCrc(ConfigPtr);
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        StatePtr->NewDataAvailable = (nullptr != DataPtrs[i]);
+
+        Std_ReturnType result = E2E_P01CheckData(ConfigPtr, StatePtr, dataIDCrc, DataPtrs[i]);
+        if (E_OK != result)
+        {
+            return result;
+        }
+        Statuses[i] = StatePtr->Status;
+    }
+
+    return E_OK;
+}
@@ -0,0 +1,120 @@
+#include <stdint.h>
+
+#include "e2e.h"
+#include "e2eCounter.h"
+#include "../CRC/crcModel.h"
+
+//This source code is helper for implementing E2E protection by AutoSar documentation: E2E Protocol Specification.
+// https://www.autosar.org/fileadmin/files/standards/foundation/
+
+//Profile 2: CRC8H2F in byte 0 over PDU bytes 1..n-1 followed by the Data ID, 4 bit counter 0..15 in the low
+//nibble of byte 1. Data ID of every counter value is taken from DataIDList.
+//
+//The specification starts with Crc_CalculateCRC8H2F(..., 0xFF, FALSE), so the register starts with 0x00.
+//Data ID is after the PDU bytes, it costs one table step per PDU.
+
+#define E2E_P02_COUNTER_RANGE   16U
+
+static uint8_t E2E_P02CalculateCrc(const E2E_P02ConfigType *ConfigPtr, uint8_t counter, const uint8_t *DataPtr)
+{
+    uint8_t crc = Crc8H2F::Restart(0xFF);
+
+    crc = Crc8H2F::Update(crc, &DataPtr[1], (ConfigPtr->DataLength / 8) - 1);
+    crc = Crc8H2F::Update(crc, &ConfigPtr->DataIDList[counter], 1);
+
+    return Crc8H2F::Finalize(crc);
+}
+
+static Std_ReturnType E2E_P02ProtectData(const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8_t *DataPtr)
+{
+    if (nullptr == DataPtr)
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    StatePtr->Counter = (StatePtr->Counter + 1) % E2E_P02_COUNTER_RANGE;
+
+    DataPtr[1] = (DataPtr[1] & 0xF0) | StatePtr->Counter;
+    DataPtr[0] = E2E_P02CalculateCrc(ConfigPtr, StatePtr->Counter, DataPtr);
+
+    return E_OK;
+}
+
+static void E2E_P02CheckData(const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8_t *DataPtr)
+{
+    if (!E2E_P0102CheckNewData<E2E_P02CheckStateType, E2E_P02_COUNTER_RANGE>(StatePtr))
+    {
+        return;
+    }
+
+    uint8_t receivedCounter = DataPtr[1] & 0x0F;
+
+    if (DataPtr[0] != E2E_P02CalculateCrc(ConfigPtr, receivedCounter, DataPtr))
+    {
+        StatePtr->Status = E2E_P02STATUS_WRONGCRC;
+        return;
+    }
+
+    E2E_P0102CheckCounter<E2E_P02CheckStateType, E2E_P02ConfigType, E2E_P02_COUNTER_RANGE>(ConfigPtr, StatePtr, receivedCounter);
+}
+
+Std_ReturnType E2E_P02Protect(const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8_t *DataPtr)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P02ProtectData(ConfigPtr, StatePtr, DataPtr);
+}
+
+// StatePtr->NewDataAvailable tells if DataPtr holds a new PDU
+Std_ReturnType E2E_P02Check(const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8_t *DataPtr)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (StatePtr->NewDataAvailable && (nullptr == DataPtr)))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    E2E_P02CheckData(ConfigPtr, StatePtr, DataPtr);
+
+    return E_OK;
+}
+
+// Next nMessages PDUs of the data element, DataPtrs[i] gets counter value of message i
+Std_ReturnType E2E_P02ProtectBatch(const E2E_P02ConfigType *ConfigPtr, E2E_P02ProtectStateType *StatePtr, uint8_t *const DataPtrs[], uint32_t nMessages)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        Std_ReturnType result = E2E_P02ProtectData(ConfigPtr, StatePtr, DataPtrs[i]);
+        if (E_OK != result)
+        {
+            return result;
+        }
+    }
+
+    return E_OK;
+}
+
+// Received PDUs in order, nullptr entry is a cycle without new data. Statuses[i] is the status after PDU i.
+Std_ReturnType E2E_P02CheckBatch(const E2E_P02ConfigType *ConfigPtr, E2E_P02CheckStateType *StatePtr, const uint8_t *const DataPtrs[], uint32_t nMessages, E2E_P02CheckStatusType Statuses[])
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs) || (nullptr == Statuses))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        StatePtr->NewDataAvailable = (nullptr != DataPtrs[i]);
+        E2E_P02CheckData(ConfigPtr, StatePtr, DataPtrs[i]);
+        Statuses[i] = StatePtr->Status;
+    }
+
+    return E_OK;
+}
@@ -0,0 +1,173 @@
+#include <stdint.h>
+
+#include "e2e.h"
+#include "e2eCounter.h"
+#include "../CRC/crcModel.h"
+
+//This source code is helper for implementing E2E protection by AutoSar documentation: E2E Protocol Specification.
+// https://www.autosar.org/fileadmin/files/standards/foundation/
+
+//Profile 4: 12 byte header at Offset, all fields big endian:
+//    Length (16 bit) | Counter (16 bit) | Data ID (32 bit) | CRC32P4 (32 bit)
+//CRC is calculated over all PDU bytes except the CRC field. Data ID is transmitted in the header after the
+//length and counter, so there is no constant Data ID prefix; batch functions only write the header and
+//calculate the PDU bytes.
+
+#define E2E_P04_HEADER_LENGTH   12U
+
+static uint16_t E2E_P04ReadU16(const uint8_t *DataPtr)
+{
+    return (uint16_t)((DataPtr[0] << 8) | DataPtr[1]);
+}
+
+static uint32_t E2E_P04ReadU32(const uint8_t *DataPtr)
+{
+    return ((uint32_t)DataPtr[0] << 24) | ((uint32_t)DataPtr[1] << 16) | ((uint32_t)DataPtr[2] << 8) | DataPtr[3];
+}
+
+static void E2E_P04WriteU16(uint8_t *DataPtr, uint16_t value)
+{
+    DataPtr[0] = (uint8_t)(value >> 8);
+    DataPtr[1] = (uint8_t)value;
+}
+
+static void E2E_P04WriteU32(uint8_t *DataPtr, uint32_t value)
+{
+    DataPtr[0] = (uint8_t)(value >> 24);
+    DataPtr[1] = (uint8_t)(value >> 16);
+    DataPtr[2] = (uint8_t)(value >> 8);
+    DataPtr[3] = (uint8_t)value;
+}
+
+static bool E2E_P04LengthValid(const E2E_P04ConfigType *ConfigPtr, uint16_t Length)
+{
+    return (Length >= ConfigPtr->MinDataLength / 8) && (Length <= ConfigPtr->MaxDataLength / 8) &&
+           (Length >= ConfigPtr->Offset / 8 + E2E_P04_HEADER_LENGTH);
+}
+
+static uint32_t E2E_P04CalculateCrc(const E2E_P04ConfigType *ConfigPtr, const uint8_t *DataPtr, uint16_t Length)
+{
+    uint32_t crcField = ConfigPtr->Offset / 8 + 8;
+    uint32_t crc = Crc32P4::Start();
+
+    crc = Crc32P4::Update(crc, DataPtr, crcField);
+    crc = Crc32P4::Update(crc, &DataPtr[crcField + 4], Length - crcField - 4);
+
+    return Crc32P4::Finalize(crc);
+}
+
+static Std_ReturnType E2E_P04ProtectData(const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8_t *DataPtr, uint16_t Length)
+{
+    if (nullptr == DataPtr)
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+    if (!E2E_P04LengthValid(ConfigPtr, Length))
+    {
+        return E2E_E_INPUTERR_WRONG;
+    }
+
+    uint8_t *header = &DataPtr[ConfigPtr->Offset / 8];
+
+    E2E_P04WriteU16(&header[0], Length);
+    E2E_P04WriteU16(&header[2], StatePtr->Counter);
+    E2E_P04WriteU32(&header[4], ConfigPtr->DataID);
+    E2E_P04WriteU32(&header[8], E2E_P04CalculateCrc(ConfigPtr, DataPtr, Length));
+
+    StatePtr->Counter++;
+
+    return E_OK;
+}
+
+static Std_ReturnType E2E_P04CheckData(const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8_t *DataPtr, uint16_t Length)
+{
+    if (nullptr == DataPtr)
+    {
+        if (0 != Length)
+        {
+            return E2E_E_INPUTERR_WRONG;
+        }
+        StatePtr->Status = E2E_P04STATUS_NONEWDATA;
+        return E_OK;
+    }
+    if (!E2E_P04LengthValid(ConfigPtr, Length))
+    {
+        return E2E_E_INPUTERR_WRONG;
+    }
+
+    const uint8_t *header = &DataPtr[ConfigPtr->Offset / 8];
+
+    if ((E2E_P04ReadU16(&header[0]) != Length) ||
+        (E2E_P04ReadU32(&header[4]) != ConfigPtr->DataID) ||
+        (E2E_P04ReadU32(&header[8]) != E2E_P04CalculateCrc(ConfigPtr, DataPtr, Length)))
+    {
+        StatePtr->Status = E2E_P04STATUS_ERROR;
+        return E_OK;
+    }
+
+    E2E_P0405CheckCounter<E2E_P04CheckStateType, uint16_t>(ConfigPtr->MaxDeltaCounter, StatePtr, E2E_P04ReadU16(&header[2]));
+
+    return E_OK;
+}
+
+Std_ReturnType E2E_P04Protect(const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8_t *DataPtr, uint16_t Length)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P04ProtectData(ConfigPtr, StatePtr, DataPtr, Length);
+}
+
+// DataPtr = nullptr with Length = 0 is a cycle without new data
+Std_ReturnType E2E_P04Check(const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8_t *DataPtr, uint16_t Length)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P04CheckData(ConfigPtr, StatePtr, DataPtr, Length);
+}
+
+// Next nMessages PDUs of the data element, DataPtrs[i] gets counter value of message i
+Std_ReturnType E2E_P04ProtectBatch(const E2E_P04ConfigType *ConfigPtr, E2E_P04ProtectStateType *StatePtr, uint8_t *const DataPtrs[], const uint16_t Lengths[], uint32_t nMessages)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs) || (nullptr == Lengths))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        Std_ReturnType result = E2E_P04ProtectData(ConfigPtr, StatePtr, DataPtrs[i], Lengths[i]);
+        if (E_OK != result)
+        {
+            return result;
+        }
+    }
+
+    return E_OK;
+}
+
+// Received PDUs in order, nullptr entry with length 0 is a cycle without new data. Statuses[i] is the status after PDU i.
+Std_ReturnType E2E_P04CheckBatch(const E2E_P04ConfigType *ConfigPtr, E2E_P04CheckStateType *StatePtr, const uint8_t *const DataPtrs[], const uint16_t Lengths[], uint32_t nMessages, E2E_P04CheckStatusType Statuses[])
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs) || (nullptr == Lengths) || (nullptr == Statuses))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        Std_ReturnType result = E2E_P04CheckData(ConfigPtr, StatePtr, DataPtrs[i], Lengths[i]);
+        if (E_OK != result)
+        {
+            return result;
+        }
+        Statuses[i] = StatePtr->Status;
+    }
+
+    return E_OK;
+}
@@ -0,0 +1,145 @@
+#include <stdint.h>
+
+#include "e2e.h"
+#include "e2eCounter.h"
+#include "../CRC/crcModel.h"
+
+//This source code is helper for implementing E2E protection by AutoSar documentation: E2E Protocol Specification.
+// https://www.autosar.org/fileadmin/files/standards/foundation/
+
+//Profile 5: 3 byte header at Offset: CRC16 CCITT-FALSE (16 bit, little endian) | Counter (8 bit).
+//CRC is calculated over all PDU bytes except the CRC field, followed by the Data ID low and high byte.
+//Data ID is after the PDU bytes, it costs two table steps per PDU.
+
+#define E2E_P05_HEADER_LENGTH   3U
+
+static uint16_t E2E_P05CalculateCrc(const E2E_P05ConfigType *ConfigPtr, const uint8_t *DataPtr, uint16_t Length)
+{
+    uint32_t crcField = ConfigPtr->Offset / 8;
+    uint8_t dataID[2] = { (uint8_t)ConfigPtr->DataID, (uint8_t)(ConfigPtr->DataID >> 8) };
+    uint16_t crc = Crc16CcittFalse::Start();
+
+    crc = Crc16CcittFalse::Update(crc, DataPtr, crcField);
+    crc = Crc16CcittFalse::Update(crc, &DataPtr[crcField + 2], Length - crcField - 2);
+    crc = Crc16CcittFalse::Update(crc, dataID, 2);
+
+    return Crc16CcittFalse::Finalize(crc);
+}
+
+static Std_ReturnType E2E_P05ProtectData(const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8_t *DataPtr, uint16_t Length)
+{
+    if (nullptr == DataPtr)
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+    if ((Length != ConfigPtr->DataLength / 8) || (Length < ConfigPtr->Offset / 8 + E2E_P05_HEADER_LENGTH))
+    {
+        return E2E_E_INPUTERR_WRONG;
+    }
+
+    uint8_t *header = &DataPtr[ConfigPtr->Offset / 8];
+
+    header[2] = StatePtr->Counter;
+
+    uint16_t crc = E2E_P05CalculateCrc(ConfigPtr, DataPtr, Length);
+    header[0] = (uint8_t)crc;
+    header[1] = (uint8_t)(crc >> 8);
+
+    StatePtr->Counter++;
+
+    return E_OK;
+}
+
+static Std_ReturnType E2E_P05CheckData(const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8_t *DataPtr, uint16_t Length)
+{
+    if (nullptr == DataPtr)
+    {
+        if (0 != Length)
+        {
+            return E2E_E_INPUTERR_WRONG;
+        }
+        StatePtr->Status = E2E_P05STATUS_NONEWDATA;
+        return E_OK;
+    }
+    if ((Length != ConfigPtr->DataLength / 8) || (Length < ConfigPtr->Offset / 8 + E2E_P05_HEADER_LENGTH))
+    {
+        return E2E_E_INPUTERR_WRONG;
+    }
+
+    const uint8_t *header = &DataPtr[ConfigPtr->Offset / 8];
+    uint16_t receivedCrc = (uint16_t)(header[0] | (header[1] << 8));
+
+    if (receivedCrc != E2E_P05CalculateCrc(ConfigPtr, DataPtr, Length))
+    {
+        StatePtr->Status = E2E_P05STATUS_ERROR;
+        return E_OK;
+    }
+
+    E2E_P0405CheckCounter<E2E_P05CheckStateType, uint8_t>(ConfigPtr->MaxDeltaCounter, StatePtr, header[2]);
+
+    return E_OK;
+}
+
+Std_ReturnType E2E_P05Protect(const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8_t *DataPtr, uint16_t Length)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P05ProtectData(ConfigPtr, StatePtr, DataPtr, Length);
+}
+
+// DataPtr = nullptr with Length = 0 is a cycle without new data
+Std_ReturnType E2E_P05Check(const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8_t *DataPtr, uint16_t Length)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    return E2E_P05CheckData(ConfigPtr, StatePtr, DataPtr, Length);
+}
+
+// Next nMessages PDUs of DataLength bits, DataPtrs[i] gets counter value of message i
+Std_ReturnType E2E_P05ProtectBatch(const E2E_P05ConfigType *ConfigPtr, E2E_P05ProtectStateType *StatePtr, uint8_t *const DataPtrs[], uint32_t nMessages)
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        Std_ReturnType result = E2E_P05ProtectData(ConfigPtr, StatePtr, DataPtrs[i], ConfigPtr->DataLength / 8);
+        if (E_OK != result)
+        {
+            return result;
+        }
+    }
+
+    return E_OK;
+}
+
+// Received PDUs in order, nullptr entry is a cycle without new data. Statuses[i] is the status after PDU i.
+Std_ReturnType E2E_P05CheckBatch(const E2E_P05ConfigType *ConfigPtr, E2E_P05CheckStateType *StatePtr, const uint8_t *const DataPtrs[], uint32_t nMessages, E2E_P05CheckStatusType Statuses[])
+{
+    if ((nullptr == ConfigPtr) || (nullptr == StatePtr) || (nullptr == DataPtrs) || (nullptr == Statuses))
+    {
+        return E2E_E_INPUTERR_NULL;
+    }
+
+    for (uint32_t i = 0; i < nMessages; i++)
+    {
+        uint16_t length = (nullptr != DataPtrs[i]) ? (uint16_t)(ConfigPtr->DataLength / 8) : 0;
+
+        Std_ReturnType result = E2E_P05CheckData(ConfigPtr, StatePtr, DataPtrs[i], length);
+        if (E_OK != result)
+        {
+            return result;
+        }
+        Statuses[i] = StatePtr->Status;
+    }
+
+    return E_OK;
+}
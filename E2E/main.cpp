@@ -0,0 +1,310 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "e2e.h"
+
+//Build:
+//    g++ -std=c++17 -O2 E2E/*.cpp CRC/crcAutosar.cpp -o e2e
+
+extern uint8_t Crc_CalculateCRC8(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_StartValue8, bool crc_IsFirstCall);
+extern uint8_t Crc_CalculateCRC8H2F(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint8_t crc_StartValue8H2F, bool crc_IsFirstCall);
+extern uint16_t Crc_CalculateCRC16(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint16_t crc_StartValue16, bool crc_IsFirstCall);
+extern uint32_t Crc_CalculateCRC32P4(const uint8_t *crc_DataPtr, uint32_t crc_Length, uint32_t crc_StartValue32, bool crc_IsFirstCall);
+
+void TestE2E(const char *name, uint32_t calculated, uint32_t expected)
+{
+    if (expected != calculated)
+    {
+        printf("Error for %s 0x%x, expected 0x%x\n", name, calculated, expected);
+    }
+    else
+    {
+        printf("%s 0x%02x OK!\n", name, calculated);
+    }
+}
+
+#define E2E_TEST_MESSAGES   40U
+
+int main()
+{
+    uint8_t pdu[E2E_TEST_MESSAGES][16];
+    uint8_t batchPdu[E2E_TEST_MESSAGES][16];
+    uint8_t *protectPtrs[E2E_TEST_MESSAGES];
+    const uint8_t *checkPtrs[E2E_TEST_MESSAGES];
+
+    for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+    {
+        for (uint32_t j = 0; j < 16; j++)
+        {
+            pdu[i][j] = (uint8_t)(i * 31 + j * 7);
+        }
+        protectPtrs[i] = batchPdu[i];
+        checkPtrs[i] = pdu[i];
+    }
+
+    /* Profile 1, CRC calculated with the call sequence of the specification */
+    {
+        E2E_P01ConfigType config = { 8, 0, 0x0123, 12, E2E_P01_DATAID_BOTH, 64, 1, 2, 2 };
+        E2E_P01ProtectStateType protectState = { 0 };
+        uint8_t dataID[2] = { 0x23, 0x01 };
+
+        E2E_P01Protect(&config, &protectState, pdu[0]);
+
+        uint8_t crc = Crc_CalculateCRC8(&dataID[0], 1, 0xFF, false);
+        crc = Crc_CalculateCRC8(&dataID[1], 1, crc, false);
+        crc = Crc_CalculateCRC8(&pdu[0][1], 7, crc, false);
+        TestE2E("E2E P01 CRC", pdu[0][0], crc ^ 0xFF);
+        TestE2E("E2E P01 counter", pdu[0][1] & 0x0F, 0);
+
+        config.DataIDMode = E2E_P01_DATAID_NIBBLE;
+        protectState.Counter = 3;
+        E2E_P01Protect(&config, &protectState, pdu[1]);
+
+        uint8_t zero = 0x00;
+        crc = Crc_CalculateCRC8(&dataID[0], 1, 0xFF, false);
+        crc = Crc_CalculateCRC8(&zero, 1, crc, false);
+        crc = Crc_CalculateCRC8(&pdu[1][1], 7, crc, false);
+        TestE2E("E2E P01 NIBBLE CRC", pdu[1][0], crc ^ 0xFF);
+        TestE2E("E2E P01 NIBBLE Data ID", pdu[1][1], 0x13);
+
+        // sequence of statuses: initial, ok, repeated, lost one, no new data, wrong CRC
+        config.DataIDMode = E2E_P01_DATAID_ALT;
+        protectState.Counter = 0;
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            E2E_P01Protect(&config, &protectState, pdu[i]);
+        }
+
+        E2E_P01CheckStateType checkState = { 0, 0, true, true, 0, E2E_P01STATUS_NONEWDATA, 0, 0 };
+        E2E_P01Check(&config, &checkState, pdu[0]);
+        TestE2E("E2E P01 INITIAL", checkState.Status, E2E_P01STATUS_INITIAL);
+        E2E_P01Check(&config, &checkState, pdu[1]);
+        TestE2E("E2E P01 OK", checkState.Status, E2E_P01STATUS_OK);
+        E2E_P01Check(&config, &checkState, pdu[1]);
+        TestE2E("E2E P01 REPEATED", checkState.Status, E2E_P01STATUS_REPEATED);
+        E2E_P01Check(&config, &checkState, pdu[3]);
+        TestE2E("E2E P01 OKSOMELOST", checkState.Status, E2E_P01STATUS_OKSOMELOST);
+        checkState.NewDataAvailable = false;
+        E2E_P01Check(&config, &checkState, nullptr);
+        TestE2E("E2E P01 NONEWDATA", checkState.Status, E2E_P01STATUS_NONEWDATA);
+        checkState.NewDataAvailable = true;
+        pdu[2][5] ^= 0x10;
+        E2E_P01Check(&config, &checkState, pdu[2]);
+        TestE2E("E2E P01 WRONGCRC", checkState.Status, E2E_P01STATUS_WRONGCRC);
+
+        // batch gives the same PDUs and statuses as single calls
+        E2E_P01ProtectStateType singleState = { 0 };
+        E2E_P01ProtectStateType batchState = { 0 };
+        memcpy(batchPdu, pdu, sizeof(pdu));
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            E2E_P01Protect(&config, &singleState, pdu[i]);
+        }
+        E2E_P01ProtectBatch(&config, &batchState, protectPtrs, E2E_TEST_MESSAGES);
+        TestE2E("E2E P01 ProtectBatch", memcmp(pdu, batchPdu, sizeof(pdu)), 0);
+
+        E2E_P01CheckStateType singleCheck = { 0, 0, true, true, 0, E2E_P01STATUS_NONEWDATA, 0, 0 };
+        E2E_P01CheckStateType batchCheck = singleCheck;
+        E2E_P01CheckStatusType statuses[E2E_TEST_MESSAGES];
+        uint32_t mismatches = 0;
+        checkPtrs[7] = pdu[6];
+        checkPtrs[9] = nullptr;
+        checkPtrs[12] = pdu[20];
+        E2E_P01CheckBatch(&config, &batchCheck, checkPtrs, E2E_TEST_MESSAGES, statuses);
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            singleCheck.NewDataAvailable = (nullptr != checkPtrs[i]);
+            E2E_P01Check(&config, &singleCheck, checkPtrs[i]);
+            mismatches += (singleCheck.Status != statuses[i]) ? 1 : 0;
+        }
+        TestE2E("E2E P01 CheckBatch", mismatches, 0);
+        TestE2E("E2E P01 CheckBatch WRONGSEQUENCE", statuses[12], E2E_P01STATUS_WRONGSEQUENCE);
+        checkPtrs[7] = pdu[7];
+        checkPtrs[9] = pdu[9];
+        checkPtrs[12] = pdu[12];
+    }
+
+    /* Profile 2 */
+    {
+        E2E_P02ConfigType config = { 64, { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xF0, 0x01 }, 1, 2, 2 };
+        E2E_P02ProtectStateType protectState = { 0 };
+
+        E2E_P02Protect(&config, &protectState, pdu[0]);
+
+        uint8_t crc = Crc_CalculateCRC8H2F(&pdu[0][1], 7, 0xFF, false);
+        crc = Crc_CalculateCRC8H2F(&config.DataIDList[1], 1, crc, false);
+        TestE2E("E2E P02 CRC", pdu[0][0], crc);
+        TestE2E("E2E P02 counter", pdu[0][1] & 0x0F, 1);
+
+        protectState.Counter = 0;
+        for (uint32_t i = 0; i < 4; i++)
+        {
+            E2E_P02Protect(&config, &protectState, pdu[i]);
+        }
+
+        E2E_P02CheckStateType checkState = { 0, 0, true, true, 0, E2E_P02STATUS_NONEWDATA, 0, 0 };
+        E2E_P02Check(&config, &checkState, pdu[0]);
+        TestE2E("E2E P02 INITIAL", checkState.Status, E2E_P02STATUS_INITIAL);
+        E2E_P02Check(&config, &checkState, pdu[1]);
+        TestE2E("E2E P02 OK", checkState.Status, E2E_P02STATUS_OK);
+        E2E_P02Check(&config, &checkState, pdu[3]);
+        TestE2E("E2E P02 OKSOMELOST", checkState.Status, E2E_P02STATUS_OKSOMELOST);
+        pdu[2][5] ^= 0x10;
+        E2E_P02Check(&config, &checkState, pdu[2]);
+        TestE2E("E2E P02 WRONGCRC", checkState.Status, E2E_P02STATUS_WRONGCRC);
+
+        E2E_P02ProtectStateType singleState = { 0 };
+        E2E_P02ProtectStateType batchState = { 0 };
+        memcpy(batchPdu, pdu, sizeof(pdu));
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            E2E_P02Protect(&config, &singleState, pdu[i]);
+        }
+        E2E_P02ProtectBatch(&config, &batchState, protectPtrs, E2E_TEST_MESSAGES);
+        TestE2E("E2E P02 ProtectBatch", memcmp(pdu, batchPdu, sizeof(pdu)), 0);
+
+        E2E_P02CheckStateType singleCheck = { 0, 0, true, true, 0, E2E_P02STATUS_NONEWDATA, 0, 0 };
+        E2E_P02CheckStateType batchCheck = singleCheck;
+        E2E_P02CheckStatusType statuses[E2E_TEST_MESSAGES];
+        uint32_t mismatches = 0;
+        checkPtrs[5] = nullptr;
+        checkPtrs[11] = pdu[30];
+        E2E_P02CheckBatch(&config, &batchCheck, checkPtrs, E2E_TEST_MESSAGES, statuses);
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            singleCheck.NewDataAvailable = (nullptr != checkPtrs[i]);
+            E2E_P02Check(&config, &singleCheck, checkPtrs[i]);
+            mismatches += (singleCheck.Status != statuses[i]) ? 1 : 0;
+        }
+        TestE2E("E2E P02 CheckBatch", mismatches, 0);
+        checkPtrs[5] = pdu[5];
+        checkPtrs[11] = pdu[11];
+    }
+
+    /* Profile 4 */
+    {
+        E2E_P04ConfigType config = { 0x0A0B0C0D, 16, 14 * 8, 16 * 8, 2 };
+        E2E_P04ProtectStateType protectState = { 0 };
+        uint16_t lengths[E2E_TEST_MESSAGES];
+
+        E2E_P04Protect(&config, &protectState, pdu[0], 16);
+
+        uint32_t crc = Crc_CalculateCRC32P4(&pdu[0][0], 10, 0xFFFFFFFF, true);
+        crc = Crc_CalculateCRC32P4(&pdu[0][14], 2, crc, false);
+        TestE2E("E2E P04 CRC", ((uint32_t)pdu[0][10] << 24) | ((uint32_t)pdu[0][11] << 16) | ((uint32_t)pdu[0][12] << 8) | pdu[0][13], crc);
+        TestE2E("E2E P04 header", (pdu[0][2] << 8) | pdu[0][3], 16);
+        TestE2E("E2E P04 Data ID", pdu[0][6], 0x0A);
+        TestE2E("E2E P04 wrong length", E2E_P04Protect(&config, &protectState, pdu[0], 13), E2E_E_INPUTERR_WRONG);
+
+        protectState.Counter = 0;
+        for (uint32_t i = 0; i < 5; i++)
+        {
+            E2E_P04Protect(&config, &protectState, pdu[i], 16);
+        }
+
+        E2E_P04CheckStateType checkState = { E2E_P04STATUS_NONEWDATA, 0xFFFF };
+        E2E_P04Check(&config, &checkState, pdu[0], 16);
+        TestE2E("E2E P04 OK", checkState.Status, E2E_P04STATUS_OK);
+        E2E_P04Check(&config, &checkState, pdu[0], 16);
+        TestE2E("E2E P04 REPEATED", checkState.Status, E2E_P04STATUS_REPEATED);
+        E2E_P04Check(&config, &checkState, pdu[2], 16);
+        TestE2E("E2E P04 OKSOMELOST", checkState.Status, E2E_P04STATUS_OKSOMELOST);
+        E2E_P04Check(&config, &checkState, nullptr, 0);
+        TestE2E("E2E P04 NONEWDATA", checkState.Status, E2E_P04STATUS_NONEWDATA);
+        E2E_P04Check(&config, &checkState, pdu[1], 16);
+        TestE2E("E2E P04 WRONGSEQUENCE", checkState.Status, E2E_P04STATUS_WRONGSEQUENCE);
+        pdu[4][15] ^= 0x01;
+        E2E_P04Check(&config, &checkState, pdu[4], 16);
+        TestE2E("E2E P04 ERROR", checkState.Status, E2E_P04STATUS_ERROR);
+
+        E2E_P04ProtectStateType singleState = { 0 };
+        E2E_P04ProtectStateType batchState = { 0 };
+        memcpy(batchPdu, pdu, sizeof(pdu));
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            lengths[i] = (uint16_t)(14 + (i % 3));
+            E2E_P04Protect(&config, &singleState, pdu[i], lengths[i]);
+        }
+        E2E_P04ProtectBatch(&config, &batchState, protectPtrs, lengths, E2E_TEST_MESSAGES);
+        TestE2E("E2E P04 ProtectBatch", memcmp(pdu, batchPdu, sizeof(pdu)), 0);
+
+        E2E_P04CheckStateType singleCheck = { E2E_P04STATUS_NONEWDATA, 0xFFFF };
+        E2E_P04CheckStateType batchCheck = singleCheck;
+        E2E_P04CheckStatusType statuses[E2E_TEST_MESSAGES];
+        uint32_t mismatches = 0;
+        checkPtrs[6] = nullptr;
+        lengths[6] = 0;
+        checkPtrs[13] = pdu[25];
+        lengths[13] = lengths[25];
+        E2E_P04CheckBatch(&config, &batchCheck, checkPtrs, lengths, E2E_TEST_MESSAGES, statuses);
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            E2E_P04Check(&config, &singleCheck, checkPtrs[i], lengths[i]);
+            mismatches += (singleCheck.Status != statuses[i]) ? 1 : 0;
+        }
+        TestE2E("E2E P04 CheckBatch", mismatches, 0);
+        checkPtrs[6] = pdu[6];
+        checkPtrs[13] = pdu[13];
+    }
+
+    /* Profile 5 */
+    {
+        E2E_P05ConfigType config = { 16, 16 * 8, 0x1234, 2 };
+        E2E_P05ProtectStateType protectState = { 0 };
+        uint8_t dataID[2] = { 0x34, 0x12 };
+
+        E2E_P05Protect(&config, &protectState, pdu[0], 16);
+
+        uint16_t crc = Crc_CalculateCRC16(&pdu[0][0], 2, 0xFFFF, true);
+        crc = Crc_CalculateCRC16(&pdu[0][4], 12, crc, false);
+        crc = Crc_CalculateCRC16(&dataID[0], 1, crc, false);
+        crc = Crc_CalculateCRC16(&dataID[1], 1, crc, false);
+        TestE2E("E2E P05 CRC", pdu[0][2] | (pdu[0][3] << 8), crc);
+        TestE2E("E2E P05 counter", pdu[0][4], 0);
+
+        protectState.Counter = 0xFE;
+        for (uint32_t i = 0; i < 5; i++)
+        {
+            E2E_P05Protect(&config, &protectState, pdu[i], 16);
+        }
+
+        E2E_P05CheckStateType checkState = { E2E_P05STATUS_NONEWDATA, 0xFD };
+        E2E_P05Check(&config, &checkState, pdu[0], 16);
+        TestE2E("E2E P05 OK", checkState.Status, E2E_P05STATUS_OK);
+        E2E_P05Check(&config, &checkState, pdu[2], 16);
+        TestE2E("E2E P05 OKSOMELOST over wrap around", checkState.Status, E2E_P05STATUS_OKSOMELOST);
+        E2E_P05Check(&config, &checkState, pdu[2], 16);
+        TestE2E("E2E P05 REPEATED", checkState.Status, E2E_P05STATUS_REPEATED);
+        pdu[3][0] ^= 0x80;
+        E2E_P05Check(&config, &checkState, pdu[3], 16);
+        TestE2E("E2E P05 ERROR", checkState.Status, E2E_P05STATUS_ERROR);
+
+        E2E_P05ProtectStateType singleState = { 0 };
+        E2E_P05ProtectStateType batchState = { 0 };
+        memcpy(batchPdu, pdu, sizeof(pdu));
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            E2E_P05Protect(&config, &singleState, pdu[i], 16);
+        }
+        E2E_P05ProtectBatch(&config, &batchState, protectPtrs, E2E_TEST_MESSAGES);
+        TestE2E("E2E P05 ProtectBatch", memcmp(pdu, batchPdu, sizeof(pdu)), 0);
+
+        E2E_P05CheckStateType singleCheck = { E2E_P05STATUS_NONEWDATA, 0xFF };
+        E2E_P05CheckStateType batchCheck = singleCheck;
+        E2E_P05CheckStatusType statuses[E2E_TEST_MESSAGES];
+        uint32_t mismatches = 0;
+        checkPtrs[8] = nullptr;
+        checkPtrs[15] = pdu[3];
+        E2E_P05CheckBatch(&config, &batchCheck, checkPtrs, E2E_TEST_MESSAGES, statuses);
+        for (uint32_t i = 0; i < E2E_TEST_MESSAGES; i++)
+        {
+            E2E_P05Check(&config, &singleCheck, checkPtrs[i], (nullptr != checkPtrs[i]) ? 16 : 0);
+            mismatches += (singleCheck.Status != statuses[i]) ? 1 : 0;
+        }
+        TestE2E("E2E P05 CheckBatch", mismatches, 0);
+        TestE2E("E2E P05 CheckBatch WRONGSEQUENCE", statuses[15], E2E_P05STATUS_WRONGSEQUENCE);
+    }
+
+    return 0;
+}